@@ -102,6 +102,8 @@ typedef struct {
     uint8_t *per_instruction_opcodes;
     /* The tools that are to be notified for instruction events for the matching code unit */
     uint8_t *per_instruction_tools;
+    /* Events recorded by the native coverage tool */
+    struct _PyCoCoverageData *coverage;
 } _PyCoMonitoringData;
 
 // To avoid repeating ourselves in deepfreeze.py, all PyCodeObject members are
@@ -14,11 +14,44 @@ extern PyObject *_PyAsyncGenValueWrapperNew(PyThreadState *state, PyObject *);
 
 /* runtime lifecycle */
 
+extern void _PyGen_Fini(PyInterpreterState *);
 extern void _PyAsyncGen_Fini(PyInterpreterState *);
 
 
 /* other API */
 
+extern void _PyGen_DebugMallocStats(FILE *out);
+
+// _PyGen_MAXSAVESIZE - largest frame (in slots) of a generator to save
+// _PyGen_MAXFREELIST - maximum number of generators of each size to save
+
+#ifndef WITH_FREELISTS
+// without freelists
+#  define _PyGen_NFREELISTS 0
+#else
+#  ifndef _PyGen_MAXSAVESIZE
+#    define _PyGen_MAXSAVESIZE 32
+#  endif
+#  define _PyGen_NFREELISTS _PyGen_MAXSAVESIZE
+#  ifndef _PyGen_MAXFREELIST
+#    define _PyGen_MAXFREELIST 100
+#  endif
+#endif
+
+struct _Py_gen_state {
+#if _PyGen_NFREELISTS > 0
+    /* Generators, coroutines and asynchronous generators all have the same
+       layout, and are sized by the number of slots of their embedded frame.
+       There is one freelist for each size from 1 to _PyGen_MAXSAVESIZE,
+       shared by the three types.  The freed object is used as the linked
+       list node, with gi_weakreflist pointing to the next node. */
+    PyGenObject *free_list[_PyGen_NFREELISTS];
+    int numfree[_PyGen_NFREELISTS];
+#else
+    char _unused;  // Empty structs are not allowed.
+#endif
+};
+
 #ifndef WITH_FREELISTS
 // without freelists
 #  define _PyAsyncGen_MAXFREELIST 0
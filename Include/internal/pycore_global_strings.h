@@ -234,12 +234,17 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_active)
         STRUCT_FOR_ID(_annotation)
         STRUCT_FOR_ID(_anonymous_)
+        STRUCT_FOR_ID(_args)
         STRUCT_FOR_ID(_argtypes_)
         STRUCT_FOR_ID(_as_parameter_)
         STRUCT_FOR_ID(_asyncio_future_blocking)
         STRUCT_FOR_ID(_blksize)
         STRUCT_FOR_ID(_bootstrap)
+        STRUCT_FOR_ID(_call_exception_handler)
+        STRUCT_FOR_ID(_callback)
+        STRUCT_FOR_ID(_cancelled)
         STRUCT_FOR_ID(_check_retval_)
+        STRUCT_FOR_ID(_context)
         STRUCT_FOR_ID(_dealloc_warn)
         STRUCT_FOR_ID(_feature_version)
         STRUCT_FOR_ID(_fields_)
@@ -258,7 +263,11 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_loop)
         STRUCT_FOR_ID(_needs_com_addref_)
         STRUCT_FOR_ID(_pack_)
+        STRUCT_FOR_ID(_remove_reader)
+        STRUCT_FOR_ID(_remove_writer)
         STRUCT_FOR_ID(_restype_)
+        STRUCT_FOR_ID(_run)
+        STRUCT_FOR_ID(_scheduled)
         STRUCT_FOR_ID(_showwarnmsg)
         STRUCT_FOR_ID(_shutdown)
         STRUCT_FOR_ID(_slotnames)
@@ -267,6 +276,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_type_)
         STRUCT_FOR_ID(_uninitialized_submodules)
         STRUCT_FOR_ID(_warn_unawaited_coroutine)
+        STRUCT_FOR_ID(_when)
         STRUCT_FOR_ID(_xoptions)
         STRUCT_FOR_ID(a)
         STRUCT_FOR_ID(abs_tol)
@@ -386,6 +396,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(dont_inherit)
         STRUCT_FOR_ID(dst)
         STRUCT_FOR_ID(dst_dir_fd)
+        STRUCT_FOR_ID(dump_path)
         STRUCT_FOR_ID(duration)
         STRUCT_FOR_ID(e)
         STRUCT_FOR_ID(eager_start)
@@ -397,6 +408,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(end_lineno)
         STRUCT_FOR_ID(end_offset)
         STRUCT_FOR_ID(endpos)
+        STRUCT_FOR_ID(entries)
         STRUCT_FOR_ID(entrypoint)
         STRUCT_FOR_ID(env)
         STRUCT_FOR_ID(errors)
@@ -424,6 +436,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(file_actions)
         STRUCT_FOR_ID(filename)
         STRUCT_FOR_ID(fileno)
+        STRUCT_FOR_ID(fileobj)
         STRUCT_FOR_ID(filepath)
         STRUCT_FOR_ID(fillvalue)
         STRUCT_FOR_ID(filters)
@@ -607,6 +620,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(pi_factory)
         STRUCT_FOR_ID(pid)
         STRUCT_FOR_ID(policy)
+        STRUCT_FOR_ID(popleft)
         STRUCT_FOR_ID(pos)
         STRUCT_FOR_ID(pos1)
         STRUCT_FOR_ID(pos2)
@@ -97,6 +97,28 @@ _Py_call_instrumentation_exc2(PyThreadState *tstate, int event,
 extern int
 _Py_Instrumentation_GetLine(PyCodeObject *code, int index);
 
+/* Coverage data of a code object, see sys.monitoring.start_coverage().
+ * The interpreter links these in a list without owning the code objects.
+ * When its code object is freed, the data stays in the list until the
+ * coverage is restarted, identified by the file name, qualified name and
+ * first line number of the code. */
+typedef struct _PyCoCoverageData {
+    struct _PyCoCoverageData *next;
+    struct _PyCoCoverageData **pprev;
+    /* NULL once the code object was freed */
+    PyCodeObject *code;
+    PyObject *filename;
+    PyObject *qualname;
+    int firstlineno;
+    /* Size of each bitmap, in bytes */
+    Py_ssize_t size;
+    /* One bitmap per kind of event, with one bit per code unit */
+    uint8_t bitmaps[1];
+} _PyCoCoverageData;
+
+extern void _PyMonitoring_DetachCoverageData(_PyCoCoverageData *coverage);
+extern void _PyMonitoring_ClearCoverage(PyInterpreterState *interp);
+
 extern PyObject _PyInstrumentation_MISSING;
 extern PyObject _PyInstrumentation_DISABLE;
 
@@ -21,7 +21,7 @@ extern "C" {
 #include "pycore_exceptions.h"    // struct _Py_exc_state
 #include "pycore_floatobject.h"   // struct _Py_float_state
 #include "pycore_function.h"      // FUNC_MAX_WATCHERS
-#include "pycore_genobject.h"     // struct _Py_async_gen_state
+#include "pycore_genobject.h"     // struct _Py_gen_state
 #include "pycore_gc.h"            // struct _gc_runtime_state
 #include "pycore_global_objects.h"  // struct _Py_interp_static_objects
 #include "pycore_import.h"        // struct _import_state
@@ -80,6 +80,10 @@ struct _is {
     int64_t id_refcount;
     int requires_idref;
     PyThread_type_lock id_mutex;
+    /* The number of buffers exported to other interpreters (see
+       _xxinterpchannels) whose release has not been requested yet.
+       Protected by the runtime's interpreters mutex. */
+    int64_t shared_buffers;
 
     /* Has been initialized to a safe state.
 
@@ -199,6 +203,7 @@ struct _is {
     struct _Py_tuple_state tuple;
     struct _Py_list_state list;
     struct _Py_dict_state dict_state;
+    struct _Py_gen_state gen;
     struct _Py_async_gen_state async_gen;
     struct _Py_context_state context;
     struct _Py_exc_state exc_state;
@@ -216,6 +221,16 @@ struct _is {
     Py_ssize_t sys_tracing_threads; /* Count of threads with c_tracefunc set */
     PyObject *monitoring_callables[PY_MONITORING_TOOL_IDS][_PY_MONITORING_EVENTS];
     PyObject *monitoring_tool_names[PY_MONITORING_TOOL_IDS];
+    /* Tool whose LINE and BRANCH events are recorded natively, or -1 */
+    int monitoring_coverage_tool;
+    /* Coverage data of live code objects, see sys.monitoring.start_coverage() */
+    struct _PyCoCoverageData *monitoring_coverage_data;
+    /* Events disabled by the coverage tool in code objects instrumented
+       before this version are re-enabled */
+    uint64_t monitoring_coverage_restart_version;
+    /* Where the coverage is dumped at exit, or NULL */
+    PyObject *monitoring_coverage_dump_path;
+    int monitoring_coverage_dump_registered;
 
     struct _Py_interp_cached_objects cached_objects;
     struct _Py_interp_static_objects static_objects;
@@ -358,8 +358,10 @@ static inline int _PyType_SUPPORTS_WEAKREFS(PyTypeObject *type) {
 extern PyObject* _PyType_AllocNoTrack(PyTypeObject *type, Py_ssize_t nitems);
 
 extern int _PyObject_InitializeDict(PyObject *obj);
-extern int _PyObject_StoreInstanceAttribute(PyObject *obj, PyDictValues *values,
-                                          PyObject *name, PyObject *value);
+PyAPI_FUNC(int) _PyObject_StoreInstanceAttribute(PyObject *obj,
+                                                PyDictValues *values,
+                                                PyObject *name,
+                                                PyObject *value);
 PyObject * _PyObject_GetInstanceAttribute(PyObject *obj, PyDictValues *values,
                                         PyObject *name);
 
@@ -49,6 +49,11 @@ PyAPI_FUNC(int) _PyInterpreterState_SetRunningMain(PyInterpreterState *);
 PyAPI_FUNC(void) _PyInterpreterState_SetNotRunningMain(PyInterpreterState *);
 PyAPI_FUNC(int) _PyInterpreterState_IsRunningMain(PyInterpreterState *);
 
+// Export for _xxinterpchannels and _xxsubinterpreters modules.
+PyAPI_FUNC(void) _PyInterpreterState_AddSharedBuffers(PyInterpreterState *,
+                                                      int delta);
+PyAPI_FUNC(int) _PyInterpreterState_HasSharedBuffers(PyInterpreterState *);
+
 
 static inline const PyConfig *
 _Py_GetMainConfig(void)
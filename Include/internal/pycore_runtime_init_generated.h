@@ -740,12 +740,17 @@ extern "C" {
     INIT_ID(_active), \
     INIT_ID(_annotation), \
     INIT_ID(_anonymous_), \
+    INIT_ID(_args), \
     INIT_ID(_argtypes_), \
     INIT_ID(_as_parameter_), \
     INIT_ID(_asyncio_future_blocking), \
     INIT_ID(_blksize), \
     INIT_ID(_bootstrap), \
+    INIT_ID(_call_exception_handler), \
+    INIT_ID(_callback), \
+    INIT_ID(_cancelled), \
     INIT_ID(_check_retval_), \
+    INIT_ID(_context), \
     INIT_ID(_dealloc_warn), \
     INIT_ID(_feature_version), \
     INIT_ID(_fields_), \
@@ -764,7 +769,11 @@ extern "C" {
     INIT_ID(_loop), \
     INIT_ID(_needs_com_addref_), \
     INIT_ID(_pack_), \
+    INIT_ID(_remove_reader), \
+    INIT_ID(_remove_writer), \
     INIT_ID(_restype_), \
+    INIT_ID(_run), \
+    INIT_ID(_scheduled), \
     INIT_ID(_showwarnmsg), \
     INIT_ID(_shutdown), \
     INIT_ID(_slotnames), \
@@ -773,6 +782,7 @@ extern "C" {
     INIT_ID(_type_), \
     INIT_ID(_uninitialized_submodules), \
     INIT_ID(_warn_unawaited_coroutine), \
+    INIT_ID(_when), \
     INIT_ID(_xoptions), \
     INIT_ID(a), \
     INIT_ID(abs_tol), \
@@ -892,6 +902,7 @@ extern "C" {
     INIT_ID(dont_inherit), \
     INIT_ID(dst), \
     INIT_ID(dst_dir_fd), \
+    INIT_ID(dump_path), \
     INIT_ID(duration), \
     INIT_ID(e), \
     INIT_ID(eager_start), \
@@ -903,6 +914,7 @@ extern "C" {
     INIT_ID(end_lineno), \
     INIT_ID(end_offset), \
     INIT_ID(endpos), \
+    INIT_ID(entries), \
     INIT_ID(entrypoint), \
     INIT_ID(env), \
     INIT_ID(errors), \
@@ -930,6 +942,7 @@ extern "C" {
     INIT_ID(file_actions), \
     INIT_ID(filename), \
     INIT_ID(fileno), \
+    INIT_ID(fileobj), \
     INIT_ID(filepath), \
     INIT_ID(fillvalue), \
     INIT_ID(filters), \
@@ -1113,6 +1126,7 @@ extern "C" {
     INIT_ID(pi_factory), \
     INIT_ID(pid), \
     INIT_ID(policy), \
+    INIT_ID(popleft), \
     INIT_ID(pos), \
     INIT_ID(pos1), \
     INIT_ID(pos2), \
@@ -303,6 +303,10 @@ def _open_code_with_warning(path):
     open_code = _open_code_with_warning
 
 
+# open_mapped() only combines open() and mmap, share the io version.
+open_mapped = io.open_mapped
+
+
 # In normal operation, both `UnsupportedOperation`s should be bound to the
 # same object.
 try:
@@ -405,6 +405,41 @@ async def wait_closed(self):
         await waiter
 
 
+def _run_ready(ready, ntodo):
+    """Run the first ntodo handles of the ready queue, skipping
+    cancelled handles."""
+    for i in range(ntodo):
+        handle = ready.popleft()
+        if handle._cancelled:
+            continue
+        handle._run()
+
+
+def _pop_due_timers(scheduled, ready, end_time):
+    """Move the timer handles due before end_time from the scheduled
+    heap to the ready queue."""
+    while scheduled:
+        handle = scheduled[0]
+        if handle._when >= end_time:
+            break
+        handle = heapq.heappop(scheduled)
+        handle._scheduled = False
+        ready.append(handle)
+
+
+_py_run_ready = _run_ready
+_py_pop_due_timers = _pop_due_timers
+
+
+try:
+    from _asyncio import _run_ready, _pop_due_timers
+except ImportError:
+    pass
+else:
+    _c_run_ready = _run_ready
+    _c_pop_due_timers = _pop_due_timers
+
+
 class BaseEventLoop(events.AbstractEventLoop):
 
     def __init__(self):
@@ -1951,13 +1986,7 @@ def _run_once(self):
 
         # Handle 'later' callbacks that are ready.
         end_time = self.time() + self._clock_resolution
-        while self._scheduled:
-            handle = self._scheduled[0]
-            if handle._when >= end_time:
-                break
-            handle = heapq.heappop(self._scheduled)
-            handle._scheduled = False
-            self._ready.append(handle)
+        _pop_due_timers(self._scheduled, self._ready, end_time)
 
         # This is the only place where callbacks are actually *called*.
         # All other places just add them to ready.
@@ -1966,23 +1995,23 @@ def _run_once(self):
         # they will be run the next time (after another I/O poll).
         # Use an idiom that is thread-safe without using locks.
         ntodo = len(self._ready)
+        if not self._debug:
+            _run_ready(self._ready, ntodo)
+            return
         for i in range(ntodo):
             handle = self._ready.popleft()
             if handle._cancelled:
                 continue
-            if self._debug:
-                try:
-                    self._current_handle = handle
-                    t0 = self.time()
-                    handle._run()
-                    dt = self.time() - t0
-                    if dt >= self.slow_callback_duration:
-                        logger.warning('Executing %s took %.3f seconds',
-                                       _format_handle(handle), dt)
-                finally:
-                    self._current_handle = None
-            else:
+            try:
+                self._current_handle = handle
+                t0 = self.time()
                 handle._run()
+                dt = self.time() - t0
+                if dt >= self.slow_callback_duration:
+                    logger.warning('Executing %s took %.3f seconds',
+                                   _format_handle(handle), dt)
+            finally:
+                self._current_handle = None
         handle = None  # Needed to break cycles when an exception occurs.
 
     def _set_coroutine_origin_tracking(self, enabled):
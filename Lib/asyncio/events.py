@@ -89,19 +89,23 @@ def _run(self):
         except (SystemExit, KeyboardInterrupt):
             raise
         except BaseException as exc:
-            cb = format_helpers._format_callback_source(
-                self._callback, self._args)
-            msg = f'Exception in callback {cb}'
-            context = {
-                'message': msg,
-                'exception': exc,
-                'handle': self,
-            }
-            if self._source_traceback:
-                context['source_traceback'] = self._source_traceback
-            self._loop.call_exception_handler(context)
+            self._call_exception_handler(exc)
         self = None  # Needed to break cycles when an exception occurs.
 
+    def _call_exception_handler(self, exc):
+        # Also called by _asyncio._run_ready() when the callback fails.
+        cb = format_helpers._format_callback_source(
+            self._callback, self._args)
+        msg = f'Exception in callback {cb}'
+        context = {
+            'message': msg,
+            'exception': exc,
+            'handle': self,
+        }
+        if self._source_traceback:
+            context['source_traceback'] = self._source_traceback
+        self._loop.call_exception_handler(context)
+
 
 class TimerHandle(Handle):
     """Object returned by timed callback registration methods."""
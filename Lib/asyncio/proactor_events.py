@@ -1,7 +1,7 @@
 """Event loop using a proactor and related classes.
 
 A proactor is a "notify-on-completion" multiplexer.  Currently a
-proactor is only implemented on Windows with IOCP.
+proactor is implemented on Windows with IOCP, and on Linux with io_uring.
 """
 
 __all__ = 'BaseProactorEventLoop',
@@ -39,6 +39,45 @@
         # Fallback to send
         _HAS_SENDMSG = False
 
+_HAS_MMSG = (hasattr(socket.socket, 'recvmmsg_into') and
+             hasattr(socket.socket, 'sendmmsg'))
+
+# Datagrams received or sent per system call by datagram transports using
+# recvmmsg()/sendmmsg(), and the receive slot size for each of them: large
+# enough to hold any UDP payload.  The received datagrams are copied out of
+# the slots, so a single receive buffer is shared by all the transports of
+# an event loop.
+_MMSG_BATCH_SIZE = 8
+_MMSG_SLOT_SIZE = 65536
+
+def _process_selector_events(loop, ready, event_list):
+    """Add the handles for the (key, mask) pairs of event_list to the
+    ready queue, for loops whose _add_callback() is not overridden."""
+    for key, mask in event_list:
+        fileobj, (reader, writer) = key.fileobj, key.data
+        if mask & selectors.EVENT_READ and reader is not None:
+            if reader._cancelled:
+                loop._remove_reader(fileobj)
+            else:
+                ready.append(reader)
+        if mask & selectors.EVENT_WRITE and writer is not None:
+            if writer._cancelled:
+                loop._remove_writer(fileobj)
+            else:
+                ready.append(writer)
+
+
+_py_process_selector_events = _process_selector_events
+
+
+try:
+    from _asyncio import _process_selector_events
+except ImportError:
+    pass
+else:
+    _c_process_selector_events = _process_selector_events
+
+
 def _test_selector_event(selector, fd, event):
     # Test if the selector is monitoring 'event' events
     # for the file descriptor 'fd'.
@@ -65,6 +104,9 @@ def __init__(self, selector=None):
         self._selector = selector
         self._make_self_pipe()
         self._transports = weakref.WeakValueDictionary()
+        # Receive buffer shared by the datagram transports using recvmmsg(),
+        # allocated on first use
+        self._mmsg_recv_arena = None
 
     def _make_socket_transport(self, sock, protocol, waiter=None, *,
                                extra=None, server=None):
@@ -748,6 +790,10 @@ async def _sendfile_native(self, transp, file, offset, count):
             self._transports[transp._sock_fd] = transp
 
     def _process_events(self, event_list):
+        add_callback = getattr(self._add_callback, '__func__', None)
+        if add_callback is base_events.BaseEventLoop._add_callback:
+            _process_selector_events(self, self._ready, event_list)
+            return
         for key, mask in event_list:
             fileobj, (reader, writer) = key.fileobj, key.data
             if mask & selectors.EVENT_READ and reader is not None:
@@ -1219,6 +1265,8 @@ def __init__(self, loop, sock, protocol, address=None,
         super().__init__(loop, sock, protocol, extra)
         self._address = address
         self._buffer_size = 0
+        self._use_mmsg = (_HAS_MMSG and
+                          sock.family in (socket.AF_INET, socket.AF_INET6))
         self._loop.call_soon(self._protocol.connection_made, self)
         # only start reading when connection_made() has been called
         self._loop.call_soon(self._add_reader,
@@ -1232,6 +1280,9 @@ def get_write_buffer_size(self):
         return self._buffer_size
 
     def _read_ready(self):
+        if self._use_mmsg:
+            self._read_ready_mmsg()
+            return
         if self._conn_lost:
             return
         try:
@@ -1247,6 +1298,34 @@ def _read_ready(self):
         else:
             self._protocol.datagram_received(data, addr)
 
+    def _read_ready_mmsg(self):
+        if self._conn_lost:
+            return
+        # The receive buffer shared with the other transports of the loop
+        arena = self._loop._mmsg_recv_arena
+        if arena is None:
+            arena = self._loop._mmsg_recv_arena = memoryview(
+                bytearray(_MMSG_BATCH_SIZE * _MMSG_SLOT_SIZE))
+        try:
+            records = self._sock.recvmmsg_into(arena, _MMSG_SLOT_SIZE)
+        except (BlockingIOError, InterruptedError):
+            pass
+        except OSError as exc:
+            self._protocol.error_received(exc)
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as exc:
+            self._fatal_error(exc, 'Fatal read error on datagram transport')
+        else:
+            # Copy everything out before calling the protocol, which may
+            # let another transport reuse the shared buffer.
+            datagrams = [(bytes(arena[offset:offset + nbytes]), addr)
+                         for offset, nbytes, addr in records]
+            for data, addr in datagrams:
+                if self._conn_lost:
+                    break
+                self._protocol.datagram_received(data, addr)
+
     def sendto(self, data, addr=None):
         if not isinstance(data, (bytes, bytearray, memoryview)):
             raise TypeError(f'data argument must be a bytes-like object, '
@@ -1292,6 +1371,9 @@ def sendto(self, data, addr=None):
         self._maybe_pause_protocol()
 
     def _sendto_ready(self):
+        if self._use_mmsg:
+            self._sendto_ready_mmsg()
+            return
         while self._buffer:
             data, addr = self._buffer.popleft()
             self._buffer_size -= len(data)
@@ -1319,3 +1401,36 @@ def _sendto_ready(self):
             self._loop._remove_writer(self._sock_fd)
             if self._closing:
                 self._call_connection_lost(None)
+
+    def _sendto_ready_mmsg(self):
+        connected = bool(self._extra['peername'])
+        while self._buffer:
+            batch = [(data, None if connected else addr)
+                     for data, addr in itertools.islice(self._buffer,
+                                                        _MMSG_BATCH_SIZE)]
+            try:
+                sent = self._sock.sendmmsg(batch)
+            except (BlockingIOError, InterruptedError):
+                break  # Try again later.
+            except (SystemExit, KeyboardInterrupt):
+                raise
+            except BaseException as exc:
+                # Drop the datagram which could not be sent, as
+                # _sendto_ready() does.
+                data, _ = self._buffer.popleft()
+                self._buffer_size -= len(data)
+                if isinstance(exc, OSError):
+                    self._protocol.error_received(exc)
+                else:
+                    self._fatal_error(
+                        exc, 'Fatal write error on datagram transport')
+                return
+            for _ in range(sent):
+                data, _ = self._buffer.popleft()
+                self._buffer_size -= len(data)
+
+        self._maybe_resume_protocol()  # May append to buffer.
+        if not self._buffer:
+            self._loop._remove_writer(self._sock_fd)
+            if self._closing:
+                self._call_connection_lost(None)
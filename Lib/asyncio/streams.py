@@ -21,6 +21,7 @@
 
 
 _DEFAULT_LIMIT = 2 ** 16  # 64 KiB
+_RECV_BUFFER_SIZE = 2 ** 16  # 64 KiB
 
 
 async def open_connection(host=None, port=None, *,
@@ -177,16 +178,22 @@ def _get_close_waiter(self, stream):
         raise NotImplementedError
 
 
-class StreamReaderProtocol(FlowControlMixin, protocols.Protocol):
+class StreamReaderProtocol(FlowControlMixin, protocols.Protocol,
+                           protocols.BufferedProtocol):
     """Helper class to adapt between Protocol and StreamReader.
 
     (This is a helper class instead of making StreamReader itself a
     Protocol subclass, because the StreamReader has other potential
     uses, and to prevent the user of the StreamReader to accidentally
     call inappropriate methods of the protocol.)
+
+    Transports supporting BufferedProtocol receive data into a buffer
+    owned by the protocol, which is reused for every read, instead of
+    allocating a new bytes object per read.
     """
 
     _source_traceback = None
+    _recv_view = None
 
     def __init__(self, stream_reader, client_connected_cb=None, loop=None):
         super().__init__(loop=loop)
@@ -280,12 +287,30 @@ def connection_lost(self, exc):
         self._stream_writer = None
         self._task = None
         self._transport = None
+        self._recv_view = None
 
     def data_received(self, data):
         reader = self._stream_reader
         if reader is not None:
             reader.feed_data(data)
 
+    def get_buffer(self, sizehint):
+        if self._recv_view is None:
+            self._recv_view = memoryview(bytearray(_RECV_BUFFER_SIZE))
+        return self._recv_view
+
+    def buffer_updated(self, nbytes):
+        data = self._recv_view[:nbytes]
+        if type(self).data_received is not StreamReaderProtocol.data_received:
+            # The receive buffer is reused, so subclasses that may keep
+            # the data get a copy of it.
+            self.data_received(bytes(data))
+            return
+        reader = self._stream_reader
+        if reader is not None:
+            # feed_data() copies the data into the reader's buffer.
+            reader.feed_data(data)
+
     def eof_received(self):
         reader = self._stream_reader
         if reader is not None:
@@ -663,10 +688,10 @@ async def readuntil(self, separator=b'\n'):
             raise exceptions.LimitOverrunError(
                 'Separator is found, but chunk is longer than limit', isep)
 
-        chunk = self._buffer[:isep + seplen]
+        chunk = bytes(memoryview(self._buffer)[:isep + seplen])
         del self._buffer[:isep + seplen]
         self._maybe_resume_transport()
-        return bytes(chunk)
+        return chunk
 
     async def read(self, n=-1):
         """Read up to `n` bytes from the stream.
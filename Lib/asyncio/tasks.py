@@ -133,7 +133,8 @@ def __init__(self, coro, *, loop=None, name=None, context=None,
         else:
             self._context = context
 
-        if eager_start and self._loop.is_running():
+        if eager_start and (events._get_running_loop() is self._loop
+                            or self._loop.is_running()):
             self.__eager_start()
         else:
             self._loop.call_soon(self.__step, context=self._context)
@@ -828,6 +829,10 @@ def _done_callback(fut):
     outer = None  # bpo-46672
     for arg in coros_or_futures:
         if arg not in arg_to_fut:
+            # Coroutines are wrapped in a Task even when an eager task
+            # factory completes them synchronously: current_task() must be
+            # the child during its eager step, as timeouts and task groups
+            # entered there bind to it and not to the caller.
             fut = ensure_future(arg, loop=loop)
             if loop is None:
                 loop = futures._get_loop(fut)
@@ -0,0 +1,460 @@
+"""Proactor event loop for Linux using io_uring.
+
+Socket and file operations are submitted to a ring shared with the
+kernel, and a single io_uring_enter() call both submits the queued
+operations and waits for their completion.  A selector event loop
+waits for readiness and then needs another system call per operation.
+"""
+
+import sys
+
+if sys.platform != 'linux':  # pragma: no cover
+    raise ImportError('linux only')
+
+import errno
+import os
+import select
+import socket
+import time
+import weakref
+
+from . import exceptions
+from . import futures
+from . import proactor_events
+from . import unix_events
+from .log import logger
+
+try:
+    import _uring
+except ImportError:  # pragma: no cover
+    _uring = None
+
+
+__all__ = (
+    'IoUringEventLoop', 'IoUringProactor', 'new_event_loop',
+)
+
+
+# Returned by a completion callback which submitted another operation
+# for the same future.
+_PENDING = object()
+
+
+def _check_result(res):
+    if res < 0:
+        raise OSError(-res, os.strerror(-res))
+    return res
+
+
+def _fileno(file):
+    if isinstance(file, int):
+        return file
+    return file.fileno()
+
+
+class _UringFuture(futures.Future):
+    """Subclass of Future which represents an operation in the ring.
+
+    Cancelling it will request the cancellation of the operation.
+    """
+
+    def __init__(self, proactor, obj, *, loop=None):
+        super().__init__(loop=loop)
+        if self._source_traceback:
+            del self._source_traceback[-1]
+        self._proactor = proactor
+        # The file or socket of the operation
+        self._obj = obj
+        self._op = None
+
+    def _repr_info(self):
+        info = super()._repr_info()
+        if self._op is not None:
+            info.insert(1, f'op={self._op}')
+        return info
+
+    def _cancel_op(self):
+        if self._op is None:
+            return
+        ring = self._proactor._ring
+        if ring is not None:
+            try:
+                ring.cancel(self._op)
+            except OSError as exc:
+                context = {
+                    'message': 'Cancelling an io_uring operation failed',
+                    'exception': exc,
+                    'future': self,
+                }
+                if self._source_traceback:
+                    context['source_traceback'] = self._source_traceback
+                self._loop.call_exception_handler(context)
+        self._op = None
+
+    def cancel(self, msg=None):
+        self._cancel_op()
+        return super().cancel(msg=msg)
+
+    def set_exception(self, exception):
+        super().set_exception(exception)
+        self._cancel_op()
+
+    def set_result(self, result):
+        super().set_result(result)
+        self._op = None
+
+
+class IoUringProactor:
+    """Proactor implementation using io_uring."""
+
+    def __init__(self, entries=256):
+        self._loop = None
+        self._results = []
+        self._ring = None
+        self._cache = {}
+        if _uring is None:
+            raise OSError(errno.ENOSYS, 'io_uring is not available')
+        self._ring = _uring.Ring(entries)
+        self._stopped_serving = weakref.WeakSet()
+
+    def _check_closed(self):
+        if self._ring is None:
+            raise RuntimeError('IoUringProactor is closed')
+
+    def __repr__(self):
+        info = ['op#=%s' % len(self._cache),
+                'result#=%s' % len(self._results)]
+        if self._ring is None:
+            info.append('closed')
+        return '<%s %s>' % (self.__class__.__name__, " ".join(info))
+
+    def set_loop(self, loop):
+        self._loop = loop
+
+    def select(self, timeout=None):
+        if not self._results:
+            self._poll(timeout)
+        tmp = self._results
+        self._results = []
+        try:
+            return tmp
+        finally:
+            # Needed to break cycles when an exception occurs.
+            tmp = None
+
+    def _result(self, value):
+        fut = self._loop.create_future()
+        fut.set_result(value)
+        return fut
+
+    def _exception(self, exc):
+        fut = self._loop.create_future()
+        fut.set_exception(exc)
+        return fut
+
+    def recv(self, conn, nbytes, flags=0):
+        self._check_closed()
+        buf = bytearray(nbytes)
+
+        def finish_recv(f, res):
+            return bytes(memoryview(buf)[:_check_result(res)])
+
+        return self._register(self._ring.recv(conn.fileno(), buf, flags),
+                              conn, finish_recv)
+
+    def recv_into(self, conn, buf, flags=0):
+        self._check_closed()
+
+        def finish_recv(f, res):
+            return _check_result(res)
+
+        return self._register(self._ring.recv(conn.fileno(), buf, flags),
+                              conn, finish_recv)
+
+    def recvfrom(self, conn, nbytes, flags=0):
+        return self._poll_call(conn, select.POLLIN,
+                               conn.recvfrom, nbytes, flags)
+
+    def recvfrom_into(self, conn, buf, nbytes=0, flags=0):
+        return self._poll_call(conn, select.POLLIN,
+                               conn.recvfrom_into, buf, nbytes, flags)
+
+    def sendto(self, conn, buf, flags=0, addr=None):
+        if addr is None:
+            return self._poll_call(conn, select.POLLOUT, conn.send, buf, flags)
+        return self._poll_call(conn, select.POLLOUT,
+                               conn.sendto, buf, flags, addr)
+
+    def send(self, conn, buf, flags=0):
+        self._check_closed()
+        fd = conn.fileno()
+        view = memoryview(buf).cast('B')
+
+        # Unlike WSASend(), send() may send only a part of the data: submit
+        # the remainder until everything is sent.
+        def finish_send(f, res):
+            nonlocal view
+            view = view[_check_result(res):]
+            if view:
+                self._register(self._ring.send(fd, view, flags),
+                               conn, finish_send, f)
+                return _PENDING
+            return None
+
+        if not view:
+            return self._result(None)
+        return self._register(self._ring.send(fd, view, flags),
+                              conn, finish_send)
+
+    def accept(self, listener):
+        self._check_closed()
+        op = self._ring.accept(listener.fileno(),
+                               socket.SOCK_NONBLOCK | socket.SOCK_CLOEXEC)
+        return self._register(op, listener, self._finish_accept)
+
+    def _finish_accept(self, f, res):
+        listener = f._obj
+        conn = socket.socket(listener.family, listener.type, listener.proto,
+                             fileno=_check_result(res))
+        conn.setblocking(False)
+        try:
+            addr = conn.getpeername()
+        except OSError:
+            # The peer is already gone: accept the next connection.
+            conn.close()
+            op = self._ring.accept(listener.fileno(),
+                                   socket.SOCK_NONBLOCK | socket.SOCK_CLOEXEC)
+            self._register(op, listener, self._finish_accept, f)
+            return _PENDING
+        return conn, addr
+
+    def connect(self, conn, address):
+        if conn.type == socket.SOCK_DGRAM:
+            # io_uring has a connect operation, but connecting a datagram
+            # socket never blocks.
+            conn.connect(address)
+            return self._result(None)
+
+        self._check_closed()
+        try:
+            conn.connect(address)
+        except (BlockingIOError, InterruptedError):
+            pass
+        except OSError as exc:
+            return self._exception(exc)
+        else:
+            return self._result(None)
+
+        def finish_connect(f, res):
+            _check_result(res)
+            err = conn.getsockopt(socket.SOL_SOCKET, socket.SO_ERROR)
+            if err:
+                raise OSError(err, f'Connect call failed {address}')
+            return None
+
+        return self._register(self._ring.poll(conn.fileno(), select.POLLOUT),
+                              conn, finish_connect)
+
+    def sendfile(self, sock, file, offset, count):
+        raise exceptions.SendfileNotAvailableError(
+            "io_uring proactor has no sendfile operation")
+
+    def read(self, file, nbytes, offset=-1):
+        self._check_closed()
+        buf = bytearray(nbytes)
+
+        def finish_read(f, res):
+            return bytes(memoryview(buf)[:_check_result(res)])
+
+        return self._register(self._ring.read(_fileno(file), buf, offset),
+                              file, finish_read)
+
+    def write(self, file, buf, offset=-1):
+        self._check_closed()
+
+        def finish_write(f, res):
+            return _check_result(res)
+
+        return self._register(self._ring.write(_fileno(file), buf, offset),
+                              file, finish_write)
+
+    def _poll_call(self, conn, events, func, *args):
+        # Operations without io_uring support: wait until the socket is
+        # ready, then call the non-blocking method.
+        self._check_closed()
+        try:
+            return self._result(func(*args))
+        except (BlockingIOError, InterruptedError):
+            pass
+        except OSError as exc:
+            return self._exception(exc)
+
+        def finish_poll(f, res):
+            _check_result(res)
+            try:
+                return func(*args)
+            except (BlockingIOError, InterruptedError):
+                self._register(self._ring.poll(conn.fileno(), events),
+                               conn, finish_poll, f)
+                return _PENDING
+
+        return self._register(self._ring.poll(conn.fileno(), events),
+                              conn, finish_poll)
+
+    def _register(self, op, obj, callback, f=None):
+        # Return a future which will be set with the value returned by
+        # callback(f, res) when the operation completes, res being its
+        # result or -errno.  The callback can submit another operation for
+        # the same future and return _PENDING.  Note that we only store obj
+        # to prevent it from being garbage collected too early.
+        if f is None:
+            f = _UringFuture(self, obj, loop=self._loop)
+            if f._source_traceback:
+                del f._source_traceback[-1]
+        f._op = op
+        self._cache[op] = (f, obj, callback)
+        return f
+
+    def _poll(self, timeout=None):
+        if timeout is not None and timeout < 0:
+            raise ValueError("negative timeout")
+
+        for op, res in self._ring.wait(timeout):
+            try:
+                f, obj, callback = self._cache.pop(op)
+            except KeyError:
+                if self._loop.get_debug():
+                    self._loop.call_exception_handler({
+                        'message': ('Ring.wait() returned an unexpected '
+                                    'completion'),
+                        'status': 'op=%s res=%s' % (op, res),
+                    })
+                continue
+
+            if obj in self._stopped_serving:
+                f.cancel()
+            # Don't call the callback if the future has been cancelled, but
+            # close a connection accepted in the meantime.
+            if f.done():
+                if callback == self._finish_accept and res >= 0:
+                    os.close(res)
+                continue
+            try:
+                value = callback(f, res)
+            except OSError as e:
+                f.set_exception(e)
+                self._results.append(f)
+            else:
+                if value is not _PENDING:
+                    f.set_result(value)
+                    self._results.append(f)
+            finally:
+                f = None
+
+    def _stop_serving(self, obj):
+        # obj is a socket.  It will be closed in
+        # BaseProactorEventLoop._stop_serving() which will make any
+        # pending operations fail quickly.
+        self._stopped_serving.add(obj)
+
+    def close(self):
+        if self._ring is None:
+            # already closed
+            return
+
+        # Cancel remaining registered operations.
+        for fut, obj, callback in list(self._cache.values()):
+            if not fut.done():
+                fut.cancel()
+
+        # Wait until all cancelled operations complete: the kernel may
+        # still write into their buffers.  Display progress every second if
+        # the loop is still running.
+        msg_update = 1.0
+        start_time = time.monotonic()
+        next_msg = start_time + msg_update
+        while self._cache:
+            if next_msg <= time.monotonic():
+                logger.debug('%r is running after closing for %.1f seconds',
+                             self, time.monotonic() - start_time)
+                next_msg = time.monotonic() + msg_update
+
+            # handle a few events, or timeout
+            self._poll(msg_update)
+
+        self._results = []
+
+        self._ring.close()
+        self._ring = None
+
+    def __del__(self):
+        self.close()
+
+
+class IoUringEventLoop(proactor_events.BaseProactorEventLoop):
+    """Proactor event loop for Linux using io_uring.
+
+    Pipes, subprocesses and signal handlers are not supported.
+    """
+
+    def __init__(self, proactor=None):
+        if proactor is None:
+            proactor = IoUringProactor()
+        super().__init__(proactor)
+
+    def run_forever(self):
+        try:
+            assert self._self_reading_future is None
+            self.call_soon(self._loop_self_reading)
+            super().run_forever()
+        finally:
+            if self._self_reading_future is not None:
+                # The cancelled operation still completes, so
+                # IoUringProactor.close() doesn't wait for it forever.
+                self._self_reading_future.cancel()
+                self._self_reading_future = None
+
+    async def pread(self, file, n, offset):
+        """Read at most n bytes from file at offset.
+
+        file is a file object or a file descriptor; the file position is
+        not changed.  The read doesn't block the event loop, even for
+        regular files.
+        """
+        return await self._proactor.read(file, n, offset)
+
+    async def pwrite(self, file, data, offset):
+        """Write data to file at offset and return the number of bytes
+        written.
+
+        file is a file object or a file descriptor; the file position is
+        not changed.
+        """
+        return await self._proactor.write(file, data, offset)
+
+    # UNIX sockets don't depend on the selector
+    create_unix_connection = (
+        unix_events._UnixSelectorEventLoop.create_unix_connection)
+    create_unix_server = unix_events._UnixSelectorEventLoop.create_unix_server
+
+    def _make_duplex_pipe_transport(self, *args, **kwargs):
+        raise NotImplementedError
+
+    def _make_read_pipe_transport(self, *args, **kwargs):
+        raise NotImplementedError
+
+    def _make_write_pipe_transport(self, *args, **kwargs):
+        raise NotImplementedError
+
+
+def new_event_loop():
+    """Return an IoUringEventLoop if the kernel supports io_uring, or a
+    SelectorEventLoop otherwise.
+
+    Can be passed as loop_factory to asyncio.run() and asyncio.Runner.
+    """
+    try:
+        proactor = IoUringProactor()
+    except OSError:
+        return unix_events.SelectorEventLoop()
+    return IoUringEventLoop(proactor)
@@ -46,7 +46,8 @@
            "BufferedReader", "BufferedWriter", "BufferedRWPair",
            "BufferedRandom", "TextIOBase", "TextIOWrapper",
            "UnsupportedOperation", "SEEK_SET", "SEEK_CUR", "SEEK_END",
-           "DEFAULT_BUFFER_SIZE", "text_encoding", "IncrementalNewlineDecoder"]
+           "DEFAULT_BUFFER_SIZE", "text_encoding", "IncrementalNewlineDecoder",
+           "open_mapped"]
 
 
 import _io
@@ -91,6 +92,32 @@ class TextIOBase(_io._TextIOBase, IOBase):
     TextIOBase.register(klass)
 del klass
 
+
+def open_mapped(file):
+    """Return the contents of a file as a read-only bytes-like object.
+
+    Regular files are mapped into memory with mmap instead of being copied
+    into a new bytes object, so that large files can be handed to
+    memoryview, re, pickle.loads() or json.loads() without a copy.  Other
+    files (and empty files, or platforms without mmap) are read into a
+    bytes object.
+
+    The returned mmap object keeps the mapping alive until it is closed or
+    garbage collected.  Replacing the file (e.g. with os.replace()) does not
+    affect it, but truncating the file in place while it is mapped makes
+    accesses beyond the new end of file fail with SIGBUS.
+    """
+    with open(file, "rb", buffering=0,
+              closefd=not isinstance(file, int)) as f:
+        try:
+            import mmap
+            return mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        except (ImportError, OSError, ValueError):
+            # No mmap, empty file, or a file which can't be mapped
+            # (e.g. a pipe).
+            return f.readall()
+
+
 try:
     from _io import _WindowsConsoleIO
 except ImportError:
@@ -105,6 +105,7 @@
 
 from .decoder import JSONDecoder, JSONDecodeError
 from .encoder import JSONEncoder
+from . import scanner
 import codecs
 
 _default_encoder = JSONEncoder(
@@ -166,18 +167,15 @@ def dump(obj, fp, *, skipkeys=False, ensure_ascii=True, check_circular=True,
         check_circular and allow_nan and
         cls is None and indent is None and separators is None and
         default is None and not sort_keys and not kw):
-        iterable = _default_encoder.iterencode(obj)
+        encoder = _default_encoder
     else:
         if cls is None:
             cls = JSONEncoder
-        iterable = cls(skipkeys=skipkeys, ensure_ascii=ensure_ascii,
+        encoder = cls(skipkeys=skipkeys, ensure_ascii=ensure_ascii,
             check_circular=check_circular, allow_nan=allow_nan, indent=indent,
             separators=separators,
-            default=default, sort_keys=sort_keys, **kw).iterencode(obj)
-    # could accelerate with writelines in some versions of Python, at
-    # a debuggability cost
-    for chunk in iterable:
-        fp.write(chunk)
+            default=default, sort_keys=sort_keys, **kw)
+    encoder._iterencode_to(obj, fp.write)
 
 
 def dumps(obj, *, skipkeys=False, ensure_ascii=True, check_circular=True,
@@ -239,6 +237,9 @@ def dumps(obj, *, skipkeys=False, ensure_ascii=True, check_circular=True,
 
 
 _default_decoder = JSONDecoder(object_hook=None, object_pairs_hook=None)
+# Only the C scanner can decode UTF-8 bytes directly.
+_decode_utf8 = (_default_decoder._decode_utf8
+                if scanner.c_make_scanner is not None else None)
 
 
 def detect_encoding(b):
@@ -298,8 +299,9 @@ def load(fp, *, cls=None, object_hook=None, parse_float=None,
 
 def loads(s, *, cls=None, object_hook=None, parse_float=None,
         parse_int=None, parse_constant=None, object_pairs_hook=None, **kw):
-    """Deserialize ``s`` (a ``str``, ``bytes`` or ``bytearray`` instance
-    containing a JSON document) to a Python object.
+    """Deserialize ``s`` (a ``str`` instance, or a ``bytes``, ``bytearray``
+    or other bytes-like object, containing a JSON document) to a Python
+    object.
 
     ``object_hook`` is an optional function that will be called with the
     result of any object literal decode (a ``dict``). The return value of
@@ -330,19 +332,44 @@ def loads(s, *, cls=None, object_hook=None, parse_float=None,
     To use a custom ``JSONDecoder`` subclass, specify it with the ``cls``
     kwarg; otherwise ``JSONDecoder`` is used.
     """
+    use_default = (cls is None and object_hook is None and
+                   parse_int is None and parse_float is None and
+                   parse_constant is None and object_pairs_hook is None and
+                   not kw)
     if isinstance(s, str):
         if s.startswith('\ufeff'):
             raise JSONDecodeError("Unexpected UTF-8 BOM (decode using utf-8-sig)",
                                   s, 0)
+    elif isinstance(s, (bytes, bytearray)):
+        encoding = detect_encoding(s)
+        if (use_default and encoding == 'utf-8' and type(s) is bytes and
+                _decode_utf8 is not None):
+            # Scan the UTF-8 directly, sparing a decoded copy of the whole
+            # document.  Invalid documents are decoded again below so that
+            # errors are reported exactly as before.
+            try:
+                return _decode_utf8(s)
+            except (ValueError, StopIteration):
+                pass
+        s = s.decode(encoding, 'surrogatepass')
     else:
-        if not isinstance(s, (bytes, bytearray)):
-            raise TypeError(f'the JSON object must be str, bytes or bytearray, '
-                            f'not {s.__class__.__name__}')
-        s = s.decode(detect_encoding(s), 'surrogatepass')
-
-    if (cls is None and object_hook is None and
-            parse_int is None and parse_float is None and
-            parse_constant is None and object_pairs_hook is None and not kw):
+        # Other bytes-like objects (e.g. memoryview or mmap) are decoded
+        # without first being copied into a bytes object.
+        try:
+            view = memoryview(s)
+        except TypeError:
+            raise TypeError(f'the JSON object must be str or a bytes-like '
+                            f'object, not {s.__class__.__name__}') from None
+        with view:
+            if not view.c_contiguous:
+                raise TypeError(f'the JSON object must be a contiguous '
+                                f'buffer, not a non-contiguous '
+                                f'{s.__class__.__name__}')
+            with view.cast('B') as data:
+                s = str(data, detect_encoding(bytes(data[:4])),
+                        'surrogatepass')
+
+    if use_default:
         return _default_decoder.decode(s)
     if cls is None:
         cls = JSONDecoder
@@ -130,6 +130,7 @@ def py_scanstring(s, end, strict=True,
 scanstring = c_scanstring or py_scanstring
 
 WHITESPACE = re.compile(r'[ \t\n\r]*', FLAGS)
+WHITESPACE_BYTES = re.compile(rb'[ \t\n\r]*', FLAGS)
 WHITESPACE_STR = ' \t\n\r'
 
 
@@ -283,7 +284,7 @@ class JSONDecoder(object):
 
     def __init__(self, *, object_hook=None, parse_float=None,
             parse_int=None, parse_constant=None, strict=True,
-            object_pairs_hook=None):
+            object_pairs_hook=None, key_cache_size=0):
         """``object_hook``, if specified, will be called with the result
         of every JSON object decoded and its return value will be used in
         place of the given ``dict``.  This can be used to provide custom
@@ -315,6 +316,11 @@ def __init__(self, *, object_hook=None, parse_float=None,
         characters will be allowed inside strings.  Control characters in
         this context are those with character codes in the 0-31 range,
         including ``'\\t'`` (tab), ``'\\n'``, ``'\\r'`` and ``'\\0'``.
+
+        ``key_cache_size`` is the number of distinct object keys to keep
+        between calls to ``decode()``, so that documents sharing the same
+        keys reuse the same key strings.  Once more keys than that have
+        been seen the cache is emptied.  The default of 0 disables caching.
         """
         self.object_hook = object_hook
         self.parse_float = parse_float or float
@@ -325,6 +331,9 @@ def __init__(self, *, object_hook=None, parse_float=None,
         self.parse_object = JSONObject
         self.parse_array = JSONArray
         self.parse_string = scanstring
+        if key_cache_size < 0:
+            raise ValueError("key_cache_size must be non-negative")
+        self.key_cache_size = key_cache_size
         self.memo = {}
         self.scan_once = scanner.make_scanner(self)
 
@@ -340,6 +349,19 @@ def decode(self, s, _w=WHITESPACE.match):
             raise JSONDecodeError("Extra data", s, end)
         return obj
 
+    def _decode_utf8(self, b, _w=WHITESPACE_BYTES.match):
+        """Return the Python representation of the UTF-8 encoded JSON
+        document in the bytes object ``b``, without first decoding all of
+        ``b`` to a ``str``.  Requires the C scanner.
+
+        Raises ValueError or StopIteration if ``b`` is not a valid
+        document; decode it to ``str`` to get a detailed error.
+        """
+        obj, end = self.scan_once(b, _w(b, 0).end())
+        if _w(b, end).end() != len(b):
+            raise ValueError("Extra data")
+        return obj
+
     def raw_decode(self, s, idx=0):
         """Decode a JSON document from ``s`` (a ``str`` beginning with
         a JSON document) and return a 2-tuple of the Python
@@ -246,10 +246,7 @@ def floatstr(o, allow_nan=self.allow_nan,
 
         if (_one_shot and c_make_encoder is not None
                 and self.indent is None):
-            _iterencode = c_make_encoder(
-                markers, self.default, _encoder, self.indent,
-                self.key_separator, self.item_separator, self.sort_keys,
-                self.skipkeys, self.allow_nan)
+            _iterencode = self._make_c_encoder()
         else:
             _iterencode = _make_iterencode(
                 markers, self.default, _encoder, self.indent, floatstr,
@@ -257,6 +254,34 @@ def floatstr(o, allow_nan=self.allow_nan,
                 self.skipkeys, _one_shot)
         return _iterencode(o, 0)
 
+    def _iterencode_to(self, o, write):
+        """Encode the given object, passing each string representation to
+        *write* as available.
+
+        Unless iterencode() is overridden, this uses the C encoder when
+        possible, which passes on its output in chunks of a few kilobytes.
+        """
+        if (type(self).iterencode is JSONEncoder.iterencode and
+                c_make_encoder is not None and self.indent is None):
+            self._make_c_encoder()(o, 0, write)
+        else:
+            for chunk in self.iterencode(o):
+                write(chunk)
+
+    def _make_c_encoder(self):
+        if self.check_circular:
+            markers = {}
+        else:
+            markers = None
+        if self.ensure_ascii:
+            _encoder = encode_basestring_ascii
+        else:
+            _encoder = encode_basestring
+        return c_make_encoder(
+            markers, self.default, _encoder, self.indent,
+            self.key_separator, self.item_separator, self.sort_keys,
+            self.skipkeys, self.allow_nan)
+
 def _make_iterencode(markers, _default, _encoder, _indent, _floatstr,
         _key_separator, _item_separator, _sort_keys, _skipkeys, _one_shot,
         ## HACK: hand-optimized bytecode; turn globals into locals
@@ -359,6 +359,7 @@ def pseudo_op(name, op, real_ops):
     ],
     "CALL": [
         "CALL_PY_EXACT_ARGS",
+        "CALL_PY_TRIVIAL",
         "CALL_PY_WITH_DEFAULTS",
         "CALL_BOUND_METHOD_EXACT_ARGS",
         "CALL_BUILTIN_CLASS",
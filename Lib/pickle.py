@@ -12,6 +12,7 @@
 
     dump(object, file)
     dumps(object) -> string
+    dumps_chunks(object) -> list
     load(file) -> object
     loads(bytes) -> object
 
@@ -37,7 +38,7 @@
 import _compat_pickle
 
 __all__ = ["PickleError", "PicklingError", "UnpicklingError", "Pickler",
-           "Unpickler", "dump", "dumps", "load", "loads"]
+           "Unpickler", "dump", "dumps", "dumps_chunks", "load", "loads"]
 
 try:
     from _pickle import PickleBuffer
@@ -829,8 +830,19 @@ def save_picklebuffer(self, obj):
                     in_band = bool(self._buffer_callback(obj))
                 if in_band:
                     # Write data in-band
-                    # XXX The C implementation avoids a copy here
-                    if m.readonly:
+                    n = m.nbytes
+                    if n >= self.framer._FRAME_SIZE_TARGET:
+                        # Like the C implementation, stream the exported
+                        # memory itself rather than a copy of it.
+                        if not m.readonly:
+                            header = BYTEARRAY8 + pack("<Q", n)
+                        elif n > 0xffffffff:
+                            header = BINBYTES8 + pack("<Q", n)
+                        else:
+                            header = BINBYTES + pack("<I", n)
+                        self._write_large_bytes(header, obj.raw())
+                        self.memoize(obj)
+                    elif m.readonly:
                         self.save_bytes(m.tobytes())
                     else:
                         self.save_bytearray(m.tobytes())
@@ -1751,6 +1763,59 @@ def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None):
     assert isinstance(res, bytes_types)
     return res
 
+class _ChunkWriter:
+    """File-like sink that collects a pickle stream as a list of chunks.
+
+    Small writes are coalesced into a shared bytearray, while writes of at
+    least _CHUNK_SIZE_MIN bytes (committed frames and the large payloads
+    that the pickler streams around its frame buffer) are kept by
+    reference instead of being copied.
+    """
+
+    _CHUNK_SIZE_MIN = 4096
+
+    def __init__(self):
+        self.chunks = []
+        self.pending = bytearray()
+
+    def write(self, data):
+        if type(data) is bytes:
+            n = len(data)
+            if n < self._CHUNK_SIZE_MIN:
+                self.pending += data
+                return n
+        else:
+            data = memoryview(data)
+            n = data.nbytes
+            if n < self._CHUNK_SIZE_MIN or not data.c_contiguous:
+                # Non C-contiguous buffers are written in physical order,
+                # like the in-band PickleBuffer payloads they come from.
+                self.pending += data.tobytes('A')
+                return n
+            data = data.cast('B')
+        self._flush()
+        self.chunks.append(data)
+        return n
+
+    def _flush(self):
+        if self.pending:
+            self.chunks.append(self.pending)
+            self.pending = bytearray()
+
+    def getchunks(self):
+        self._flush()
+        return self.chunks
+
+def _dump_chunks(pickler, obj, protocol, fix_imports, buffer_callback):
+    writer = _ChunkWriter()
+    pickler(writer, protocol, fix_imports=fix_imports,
+            buffer_callback=buffer_callback).dump(obj)
+    return writer.getchunks()
+
+def _dumps_chunks(obj, protocol=None, *, fix_imports=True,
+                  buffer_callback=None):
+    return _dump_chunks(_Pickler, obj, protocol, fix_imports, buffer_callback)
+
 def _load(file, *, fix_imports=True, encoding="ASCII", errors="strict",
           buffers=None):
     return _Unpickler(file, fix_imports=fix_imports, buffers=buffers,
@@ -1781,6 +1846,18 @@ def _loads(s, /, *, fix_imports=True, encoding="ASCII", errors="strict",
     Pickler, Unpickler = _Pickler, _Unpickler
     dump, dumps, load, loads = _dump, _dumps, _load, _loads
 
+def dumps_chunks(obj, protocol=None, *, fix_imports=True,
+                 buffer_callback=None):
+    """Return the pickled representation of obj as a list of chunks.
+
+    The concatenation of the chunks equals dumps(obj, ...).  Large bytes,
+    bytearray and in-band PickleBuffer payloads are referenced rather than
+    copied into the stream, so the result can be handed to
+    socket.sendmsg() or written out piecewise without joining it.  Those
+    objects must not be mutated until the chunks have been consumed.
+    """
+    return _dump_chunks(Pickler, obj, protocol, fix_imports, buffer_callback)
+
 # Doctest
 def _test():
     import doctest
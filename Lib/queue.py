@@ -295,6 +295,29 @@ def get(self, block=True, timeout=None):
             raise Empty
         return self._queue.popleft()
 
+    def put_many(self, items, /):
+        '''Put all the items of an iterable on the queue, in order.
+
+        This method never blocks.
+        '''
+        items = list(items)
+        if items:
+            self._queue.extend(items)
+            self._count.release(len(items))
+
+    def get_many(self, max_items, /, block=True, timeout=None):
+        '''Remove and return a list of up to 'max_items' items from the queue.
+
+        Wait for the first item like get() does, then also take whichever
+        other items are immediately available, up to 'max_items' in total.
+        '''
+        if max_items <= 0:
+            raise ValueError("'max_items' must be a positive number")
+        items = [self.get(block, timeout)]
+        while len(items) < max_items and self._count.acquire(False):
+            items.append(self._queue.popleft())
+        return items
+
     def put_nowait(self, item):
         '''Put an item into the queue without blocking.
 
@@ -6,6 +6,7 @@
 
 
 from abc import ABCMeta, abstractmethod
+from array import array
 from collections import namedtuple
 from collections.abc import Mapping
 import math
@@ -445,6 +446,12 @@ class EpollSelector(_PollLikeSelector):
         _EVENT_READ = select.EPOLLIN
         _EVENT_WRITE = select.EPOLLOUT
 
+        def __init__(self):
+            super().__init__()
+            # (fd, events) pairs filled in by epoll.poll_into(); reused
+            # across calls to avoid building a list of tuples every time.
+            self._poll_buffer = array('Q')
+
         def fileno(self):
             return self._selector.fileno()
 
@@ -462,13 +469,18 @@ def select(self, timeout=None):
             # we want to make sure that `select()` can be called when no
             # FD is registered.
             max_ev = max(len(self._fd_to_key), 1)
+            buf = self._poll_buffer
+            if len(buf) < 2 * max_ev:
+                buf = self._poll_buffer = array('Q', bytes(16 * max_ev))
 
             ready = []
             try:
-                fd_event_list = self._selector.poll(timeout, max_ev)
+                nfds = self._selector.poll_into(buf, timeout)
             except InterruptedError:
                 return ready
-            for fd, event in fd_event_list:
+            for i in range(nfds):
+                fd = buf[2 * i]
+                event = buf[2 * i + 1]
                 events = 0
                 if event & ~select.EPOLLIN:
                     events |= EVENT_WRITE
@@ -2416,6 +2416,27 @@ def test_reduce_calls_base(self):
             y = self.loads(s)
             self.assertEqual(y._reduce_called, 1)
 
+    def test_build_instance_dict(self):
+        x = ReadOnlyAttrs()
+        x.__dict__.update(a=1, b=[2], prop='shadowed')
+        x.__dict__[3] = 'non-str key'
+        x.__dict__.update(('k%d' % i, i) for i in range(50))
+        for proto in protocols:
+            s = self.dumps(x, proto)
+            y = self.loads(s)
+            self.assertEqual(y.prop, 'property')
+            self.assertEqual(list(y.__dict__.items()),
+                             list(x.__dict__.items()))
+
+            c = C()
+            c.a = 1
+            c.b = 2
+            y = self.loads(self.dumps(c, proto))
+            self.assertEqual(y, c)
+            y.c = 3
+            del y.a
+            self.assertEqual(y.__dict__, {'b': 2, 'c': 3})
+
     @no_tracing
     def test_bad_getattr(self):
         # Issue #3514: crash when there is an infinite loop in __getattr__
@@ -3425,6 +3446,16 @@ class BadGetattr:
     def __getattr__(self, key):
         self.foo
 
+class ReadOnlyAttrs:
+    # The default BUILD stores the state in __dict__ directly, without
+    # calling __setattr__ or data descriptors.
+    def __setattr__(self, name, value):
+        raise AttributeError(name)
+
+    @property
+    def prop(self):
+        return 'property'
+
 
 class AbstractPickleModuleTests:
 
@@ -3610,6 +3641,38 @@ def loads(data, **kwargs):
 
         self.check_dumps_loads_oob_buffers(dumps, loads)
 
+    def test_dumps_chunks(self):
+        big = bytes(range(256)) * 1024
+        big_array = bytearray(big)
+        obj = [b'abc', big, 'xyz' * 100000, list(range(1000)), big]
+        for proto in protocols:
+            chunks = self.dumps_chunks(obj, proto)
+            self.assertIsInstance(chunks, list)
+            data = b''.join(chunks)
+            self.assertEqual(data, self.dumps(obj, proto))
+            self.assertEqual(self.loads(data), obj)
+            if proto >= 3:
+                # Large payloads are referenced rather than copied
+                self.assertEqual(sum(c is big for c in chunks), 1)
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            for obj in big_array, pickle.PickleBuffer(big_array):
+                chunks = self.dumps_chunks(obj, proto)
+                self.assertEqual(b''.join(chunks), self.dumps(obj, proto))
+                self.assertTrue(any(isinstance(c, memoryview) and
+                                    c.obj is big_array for c in chunks))
+
+    def test_dumps_chunks_oob_buffers(self):
+        obj = pickle.PickleBuffer(bytes(range(256)) * 1024)
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            buffers = []
+            chunks = self.dumps_chunks(obj, proto,
+                                       buffer_callback=buffers.append)
+            self.assertEqual(buffers, [obj])
+            data = b''.join(chunks)
+            self.assertLess(len(data), 100)
+            self.assertEqual(data, self.dumps(obj, proto,
+                                              buffer_callback=[].append))
+
 
 class AbstractPersistentPicklerTests:
 
@@ -85,8 +85,9 @@ def is_running(self):
     def close(self):
         """Finalize and destroy the interpreter.
 
-        Attempting to destroy the current interpreter results
-        in a RuntimeError.
+        Attempting to destroy the current interpreter, or an interpreter
+        whose memoryviews sent through a channel are still in use by
+        another interpreter, results in a RuntimeError.
         """
         return _interpreters.destroy(self._id)
 
@@ -178,7 +179,9 @@ class SendChannel(_ChannelEnd):
     def send(self, obj):
         """Send the object (i.e. its data) to the channel's receiving end.
 
-        This blocks until the object is received.
+        This blocks until the object is received.  A memoryview is shared
+        rather than copied, so this interpreter cannot be closed while the
+        received view is alive.
         """
         _channels.send(self._id, obj)
         # XXX We are missing a low-level channel_send_wait().
@@ -591,6 +591,88 @@ def test_send_recv_different_interpreters(self):
 
         self.assertEqual(obj, b'spam')
 
+    def test_send_recv_memoryview_main(self):
+        cid = channels.create()
+        orig = bytearray(b'spam')
+        channels.send(cid, memoryview(orig))
+        obj = channels.recv(cid)
+
+        self.assertIsInstance(obj, memoryview)
+        self.assertTrue(obj.readonly)
+        self.assertEqual(obj, b'spam')
+        # The buffer is shared, not copied.
+        orig[0] = ord('S')
+        self.assertEqual(obj, b'Spam')
+        obj.release()
+
+    def test_send_recv_memoryview_different_interpreters(self):
+        cid = channels.create()
+        orig = bytearray(b'spam' * 1000)
+        channels.send(cid, memoryview(orig)[::2])
+        channels.send(cid, memoryview(orig))
+        id1 = interpreters.create()
+        out = _run_output(id1, dedent(f"""
+            import os
+            import _xxinterpchannels as _channels
+            obj = _channels.recv({cid})
+            assert isinstance(obj, memoryview), type(obj)
+            assert obj.readonly
+            assert obj == b'sa' * 1000, bytes(obj[:10])
+            obj.release()
+
+            obj = _channels.recv({cid})
+            assert obj.readonly
+            assert obj.c_contiguous
+            try:
+                obj[0] = 0
+            except TypeError:
+                pass
+            else:
+                raise AssertionError('memoryview is writable')
+            # A writable buffer cannot be requested from the shared object.
+            r, w = os.pipe()
+            os.write(w, b'x')
+            try:
+                os.readv(r, [obj.obj])
+            except BufferError:
+                pass
+            else:
+                raise AssertionError('buffer is writable')
+            finally:
+                os.close(r)
+                os.close(w)
+            obj.release()
+            print('okay', end='')
+            """))
+
+        self.assertEqual(out, 'okay')
+        self.assertEqual(orig, b'spam' * 1000)
+
+    def test_send_memoryview_destroy_sender(self):
+        # The sending interpreter cannot be destroyed while another
+        # interpreter can still read its memory.
+        cid = channels.create()
+        id1 = interpreters.create()
+        interpreters.run_string(id1, dedent(f"""
+            import _xxinterpchannels as _channels
+            buf = bytearray(b'spam')
+            _channels.send({cid}, memoryview(buf))
+            _channels.send({cid}, memoryview(buf))
+            """))
+        obj = channels.recv(cid)
+        with self.assertRaisesRegex(RuntimeError, 'shared'):
+            interpreters.destroy(id1)
+        self.assertEqual(obj, b'spam')
+        obj.release()
+        del obj
+
+        # The second view is still in the channel.
+        with self.assertRaisesRegex(RuntimeError, 'shared'):
+            interpreters.destroy(id1)
+        channels.destroy(cid)
+        interpreters.destroy(id1)
+        self.assertNotIn(id1, interpreters.list_all())
+
     def test_send_recv_different_threads(self):
         cid = channels.create()
 
@@ -1,7 +1,10 @@
 """Tests for base_events.py"""
 
+import collections
 import concurrent.futures
+import contextvars
 import errno
+import heapq
 import math
 import socket
 import sys
@@ -1963,6 +1966,141 @@ async def runner(loop):
             outer_loop.close()
 
 
+class BaseRunReadyTests:
+    _run_ready = None
+    _pop_due_timers = None
+
+    def setUp(self):
+        super().setUp()
+        self.loop = asyncio.new_event_loop()
+        self.set_event_loop(self.loop)
+
+    def test_run_ready(self):
+        calls = []
+        ready = collections.deque()
+        ready.append(asyncio.Handle(calls.append, (1,), self.loop))
+        h = asyncio.Handle(calls.append, (2,), self.loop)
+        h.cancel()
+        ready.append(h)
+        ready.append(asyncio.TimerHandle(0, calls.append, [3], self.loop))
+        ready.append(asyncio.Handle(calls.append, (4,), self.loop))
+        self._run_ready(ready, 3)
+        self.assertEqual(calls, [1, 3])
+        self.assertEqual(len(ready), 1)
+
+    def test_run_ready_context(self):
+        var = contextvars.ContextVar('var', default=None)
+        values = []
+        ctx = contextvars.copy_context()
+        ctx.run(var.set, 'spam')
+        ready = collections.deque([
+            asyncio.Handle(lambda: values.append(var.get()), (), self.loop,
+                           context=ctx),
+            asyncio.Handle(lambda: values.append(var.get()), (), self.loop),
+        ])
+        self._run_ready(ready, 2)
+        self.assertEqual(values, ['spam', None])
+
+    def test_run_ready_exception(self):
+        def fail():
+            raise ZeroDivisionError
+        handler = mock.Mock()
+        self.loop.set_exception_handler(handler)
+        calls = []
+        h = asyncio.Handle(fail, (), self.loop)
+        ready = collections.deque([h,
+                                   asyncio.Handle(calls.append, (1,), self.loop)])
+        self._run_ready(ready, 2)
+        self.assertEqual(calls, [1])
+        handler.assert_called_once()
+        loop, context = handler.call_args[0]
+        self.assertIs(loop, self.loop)
+        self.assertIs(context['handle'], h)
+        self.assertIsInstance(context['exception'], ZeroDivisionError)
+        self.assertRegex(context['message'], 'Exception in callback .*fail')
+
+    def test_run_ready_system_exit(self):
+        def exit():
+            raise SystemExit
+        calls = []
+        ready = collections.deque([asyncio.Handle(exit, (), self.loop),
+                                   asyncio.Handle(calls.append, (1,), self.loop)])
+        with self.assertRaises(SystemExit):
+            self._run_ready(ready, 2)
+        self.assertEqual(calls, [])
+        self.assertEqual(len(ready), 1)
+
+    def test_run_ready_subclass(self):
+        calls = []
+        class MyHandle(asyncio.Handle):
+            __slots__ = ()
+            def _run(self):
+                calls.append('run')
+        ready = collections.deque([MyHandle(calls.append, (1,), self.loop)])
+        self._run_ready(ready, 1)
+        self.assertEqual(calls, ['run'])
+
+    def test_run_ready_patched_run(self):
+        # A replaced Handle._run() is called for Handle and TimerHandle
+        calls = []
+        def _run(self):
+            calls.append('run')
+        ready = collections.deque([
+            asyncio.Handle(calls.append, (1,), self.loop),
+            asyncio.TimerHandle(0, calls.append, (2,), self.loop),
+        ])
+        with mock.patch.object(asyncio.Handle, '_run', _run):
+            self._run_ready(ready, 2)
+        self.assertEqual(calls, ['run', 'run'])
+        ready.append(asyncio.Handle(calls.append, (3,), self.loop))
+        self._run_ready(ready, 1)
+        self.assertEqual(calls, ['run', 'run', 3])
+
+    def test_pop_due_timers(self):
+        scheduled = []
+        handles = [asyncio.TimerHandle(when, lambda: None, (), self.loop)
+                   for when in (5.0, 1.0, 4.0, 2.0, 2.0, 3.0, 6.0)]
+        for h in handles:
+            h._scheduled = True
+            heapq.heappush(scheduled, h)
+        ready = collections.deque()
+        self._pop_due_timers(scheduled, ready, 4.0)
+        self.assertEqual([h._when for h in ready], [1.0, 2.0, 2.0, 3.0])
+        self.assertTrue(all(not h._scheduled for h in ready))
+        self.assertEqual(len(scheduled), 3)
+        self.assertTrue(all(h._scheduled for h in scheduled))
+        self.assertEqual([heapq.heappop(scheduled)._when for _ in range(3)],
+                         [4.0, 5.0, 6.0])
+
+    def test_pop_due_timers_subclass(self):
+        # Subclasses are ordered by their own __lt__()
+        class ReversedTimerHandle(asyncio.TimerHandle):
+            __slots__ = ()
+            def __lt__(self, other):
+                return self._when > other._when
+        scheduled = []
+        for when in (1.0, 3.0, 2.0):
+            heapq.heappush(scheduled, ReversedTimerHandle(when, lambda: None,
+                                                          (), self.loop))
+        ready = collections.deque()
+        self._pop_due_timers(scheduled, ready, 10.0)
+        self.assertEqual([h._when for h in ready], [3.0, 2.0, 1.0])
+        self.assertEqual(scheduled, [])
+
+
+class PyRunReadyTests(BaseRunReadyTests, test_utils.TestCase):
+    _run_ready = staticmethod(base_events._py_run_ready)
+    _pop_due_timers = staticmethod(base_events._py_pop_due_timers)
+
+
+@unittest.skipUnless(hasattr(base_events, '_c_run_ready'),
+                     'requires the C _asyncio module')
+class CRunReadyTests(BaseRunReadyTests, test_utils.TestCase):
+    _run_ready = staticmethod(getattr(base_events, '_c_run_ready', None))
+    _pop_due_timers = staticmethod(getattr(base_events, '_c_pop_due_timers',
+                                           None))
+
+
 class BaseLoopSockSendfileTests(test_utils.TestCase):
 
     DATA = b"12345abcde" * 16 * 1024  # 160 KiB
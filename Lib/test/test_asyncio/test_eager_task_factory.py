@@ -102,6 +102,39 @@ async def run():
 
         self.assertEqual(self.run_coro(run()), 'finished after blocking')
 
+    def test_eager_start_running_loop(self):
+
+        async def coro():
+            return 'hello'
+
+        async def run():
+            # The loop defaults to the running loop, and is_running()
+            # does not need to be called for it.
+            with mock.patch.object(self.loop, 'is_running',
+                                   side_effect=AssertionError):
+                t = self.Task(coro(), eager_start=True)
+            self.assertTrue(t.done())
+            return await t
+
+        self.assertEqual(self.run_coro(run()), 'hello')
+
+    def test_eager_start_other_loop(self):
+
+        async def coro():
+            return 'hello'
+
+        other_loop = asyncio.new_event_loop()
+        self.addCleanup(other_loop.close)
+
+        async def run():
+            # The other loop is not running, so the task is started lazily.
+            t = self.Task(coro(), loop=other_loop, eager_start=True)
+            self.assertFalse(t.done())
+            return t
+
+        t = self.run_coro(run())
+        self.assertEqual(other_loop.run_until_complete(t), 'hello')
+
     def test_cancellation_after_eager_completion(self):
 
         async def coro():
@@ -187,6 +220,33 @@ async def run():
 
         self.run_coro(run())
 
+    def test_gather_eager_step_has_own_task(self):
+        # gather() keeps a Task for each eagerly started child, since
+        # current_task() during the eager step must be the child's task:
+        # timeouts and task groups entered there bind to it.
+        outer_task = None
+        child_tasks = []
+
+        async def child(delay):
+            child_tasks.append(asyncio.current_task())
+            async with asyncio.timeout(0.01):
+                await asyncio.sleep(delay)
+            return delay
+
+        async def run():
+            nonlocal outer_task
+            outer_task = asyncio.current_task()
+            return await asyncio.gather(child(0), child(10),
+                                        return_exceptions=True)
+
+        res = self.run_coro(run())
+        self.assertEqual(res[0], 0)
+        self.assertIsInstance(res[1], TimeoutError)
+        self.assertEqual(outer_task.cancelling(), 0)
+        self.assertEqual(len(child_tasks), 2)
+        self.assertNotIn(outer_task, child_tasks)
+        self.assertIsInstance(child_tasks[0], self.Task)
+
     def test_context_vars(self):
         cv = contextvars.ContextVar('cv', default=0)
 
@@ -2183,6 +2183,58 @@ class SelectEventLoopTests(UnixEventLoopTestsMixin,
         def create_event_loop(self):
             return asyncio.SelectorEventLoop(selectors.SelectSelector())
 
+    try:
+        from asyncio import uring_events
+        uring_events.IoUringProactor().close()
+    except (ImportError, OSError):
+        uring_events = None
+
+    if uring_events is not None:
+        class IoUringEventLoopTests(EventLoopTestsMixin,
+                                    test_utils.TestCase):
+
+            def create_event_loop(self):
+                return uring_events.IoUringEventLoop()
+
+            def test_reader_callback(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_reader()")
+
+            def test_writer_callback(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_writer()")
+
+            def test_remove_fds_after_closing(self):
+                raise unittest.SkipTest("IoUringEventLoop does not have add_reader()")
+
+            def test_add_signal_handler(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support signals")
+
+            def test_signal_handling_args(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support signals")
+
+            def test_signal_handling_while_selecting(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support signals")
+
+            def test_read_pipe(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support pipes")
+
+            def test_unclosed_pipe_transport(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support pipes")
+
+            def test_write_pipe(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support pipes")
+
+            def test_write_pipe_disconnect_on_close(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support pipes")
+
+            def test_read_pty_output(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support pipes")
+
+            def test_write_pty(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support pipes")
+
+            def test_bidirectional_pty(self):
+                raise unittest.SkipTest("IoUringEventLoop does not support pipes")
+
 
 def noop(*args, **kwargs):
     pass
@@ -365,6 +365,56 @@ def test_accept_connection_multiple(self):
         self.assertEqual(sock.accept.call_count, backlog)
 
 
+class BaseProcessSelectorEventsTests:
+    _process_selector_events = None
+
+    def setUp(self):
+        super().setUp()
+        self.loop = TestBaseSelectorEventLoop(mock.Mock())
+        self.set_event_loop(self.loop)
+
+    def test_process_selector_events(self):
+        reader = asyncio.Handle(lambda: None, (), self.loop)
+        writer = asyncio.Handle(lambda: None, (), self.loop)
+        cancelled = asyncio.Handle(lambda: None, (), self.loop)
+        cancelled.cancel()
+        self.loop._remove_reader = mock.Mock()
+        self.loop._remove_writer = mock.Mock()
+        ready = collections.deque()
+        EVENT_READ, EVENT_WRITE = selectors.EVENT_READ, selectors.EVENT_WRITE
+        both = EVENT_READ | EVENT_WRITE
+        self._process_selector_events(self.loop, ready, [
+            (selectors.SelectorKey(1, 1, both, (reader, writer)), both),
+            (selectors.SelectorKey(2, 2, both, (reader, writer)), EVENT_WRITE),
+            (selectors.SelectorKey(3, 3, EVENT_READ, (cancelled, None)), both),
+            (selectors.SelectorKey(4, 4, EVENT_WRITE, (None, cancelled)),
+             EVENT_WRITE),
+        ])
+        self.assertEqual(list(ready), [reader, writer, writer])
+        self.loop._remove_reader.assert_called_once_with(3)
+        self.loop._remove_writer.assert_called_once_with(4)
+
+    def test_process_selector_events_error(self):
+        ready = collections.deque()
+        with self.assertRaises(ValueError):
+            self._process_selector_events(self.loop, ready, [
+                (selectors.SelectorKey(1, 1, 1, (None,)), 1)])
+
+
+class PyProcessSelectorEventsTests(BaseProcessSelectorEventsTests,
+                                   test_utils.TestCase):
+    _process_selector_events = staticmethod(
+        selector_events._py_process_selector_events)
+
+
+@unittest.skipUnless(hasattr(selector_events, '_c_process_selector_events'),
+                     'requires the C _asyncio module')
+class CProcessSelectorEventsTests(BaseProcessSelectorEventsTests,
+                                  test_utils.TestCase):
+    _process_selector_events = staticmethod(
+        getattr(selector_events, '_c_process_selector_events', None))
+
+
 class SelectorTransportTests(test_utils.TestCase):
 
     def setUp(self):
@@ -1497,5 +1547,171 @@ class MyException(Exception):
             exc_info=(MyException, MOCK_ANY, MOCK_ANY))
 
 
+@unittest.skipUnless(selector_events._HAS_MMSG, 'no recvmmsg/sendmmsg')
+class SelectorDatagramTransportMmsgTests(test_utils.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.loop = self.new_test_loop()
+        # The test loop is not a selector event loop
+        self.loop._mmsg_recv_arena = None
+        self.protocol = test_utils.make_test_protocol(asyncio.DatagramProtocol)
+        self.sock = mock.Mock(spec_set=socket.socket)
+        self.sock.fileno.return_value = 7
+        self.sock.family = socket.AF_INET
+
+    def datagram_transport(self, address=None):
+        self.sock.getpeername.side_effect = None if address else OSError
+        transport = _SelectorDatagramTransport(self.loop, self.sock,
+                                               self.protocol,
+                                               address=address)
+        self.addCleanup(close_transport, transport)
+        return transport
+
+    def test_read_ready(self):
+        transport = self.datagram_transport()
+
+        def recvmmsg_into(buf, bufsize):
+            buf[:5] = b'data1'
+            buf[bufsize:bufsize + 5] = b'data2'
+            return [(0, 5, ('0.0.0.0', 1234)),
+                    (bufsize, 5, ('0.0.0.1', 4321))]
+
+        self.sock.recvmmsg_into.side_effect = recvmmsg_into
+        transport._read_ready()
+
+        self.assertFalse(self.sock.recvfrom.called)
+        self.assertEqual(self.protocol.datagram_received.call_args_list,
+                         [mock.call(b'data1', ('0.0.0.0', 1234)),
+                          mock.call(b'data2', ('0.0.0.1', 4321))])
+
+    def test_read_ready_subclass(self):
+        # The reader is the transport's _read_ready(), which subclasses
+        # can override
+        calls = []
+        class Transport(_SelectorDatagramTransport):
+            def _read_ready(self):
+                calls.append('read')
+        transport = Transport(self.loop, self.sock, self.protocol)
+        self.addCleanup(close_transport, transport)
+        test_utils.run_briefly(self.loop)
+        self.loop.assert_reader(7, transport._read_ready)
+        self.loop.readers[7]._run()
+        self.assertEqual(calls, ['read'])
+        self.assertFalse(self.sock.recvmmsg_into.called)
+
+    def test_read_ready_shared_buffer(self):
+        buffers = []
+
+        def recvmmsg_into(buf, bufsize):
+            buffers.append(buf)
+            return [(0, 0, ('0.0.0.0', 1234))]
+
+        self.sock.recvmmsg_into.side_effect = recvmmsg_into
+        transport1 = self.datagram_transport()
+        transport2 = self.datagram_transport()
+        transport1._read_ready()
+        transport2._read_ready()
+        transport1._read_ready()
+
+        self.assertEqual(len(buffers), 3)
+        self.assertIs(buffers[0], buffers[1])
+        self.assertIs(buffers[0], buffers[2])
+        self.assertIs(buffers[0], self.loop._mmsg_recv_arena)
+
+    def test_read_ready_closed_by_protocol(self):
+        transport = self.datagram_transport()
+        self.sock.recvmmsg_into.return_value = [(0, 0, ()), (1, 0, ())]
+        self.protocol.datagram_received.side_effect = (
+            lambda data, addr: transport.abort())
+        transport._read_ready()
+
+        self.assertEqual(self.protocol.datagram_received.call_count, 1)
+
+    def test_read_ready_tryagain(self):
+        transport = self.datagram_transport()
+
+        self.sock.recvmmsg_into.side_effect = BlockingIOError
+        transport._fatal_error = mock.Mock()
+        transport._read_ready()
+
+        self.assertFalse(self.protocol.datagram_received.called)
+        self.assertFalse(transport._fatal_error.called)
+
+    def test_read_ready_oserr(self):
+        transport = self.datagram_transport()
+
+        err = self.sock.recvmmsg_into.side_effect = OSError()
+        transport._fatal_error = mock.Mock()
+        transport._read_ready()
+
+        self.assertFalse(transport._fatal_error.called)
+        self.protocol.error_received.assert_called_with(err)
+
+    def test_sendto_ready(self):
+        self.sock.sendmmsg.return_value = 2
+
+        transport = self.datagram_transport()
+        transport._buffer.append((b'data1', ('0.0.0.0', 12345)))
+        transport._buffer.append((b'data2', ('0.0.0.1', 12345)))
+        transport._buffer_size = 10
+        self.loop._add_writer(7, transport._sendto_ready)
+        transport._sendto_ready()
+
+        self.sock.sendmmsg.assert_called_once_with(
+            [(b'data1', ('0.0.0.0', 12345)), (b'data2', ('0.0.0.1', 12345))])
+        self.assertFalse(transport._buffer)
+        self.assertEqual(transport.get_write_buffer_size(), 0)
+        self.assertFalse(self.loop.writers)
+
+    def test_sendto_ready_connected(self):
+        self.sock.sendmmsg.return_value = 1
+
+        transport = self.datagram_transport(address=('0.0.0.0', 1))
+        transport._buffer.append((b'data', ('0.0.0.0', 1)))
+        transport._sendto_ready()
+
+        self.sock.sendmmsg.assert_called_once_with([(b'data', None)])
+
+    def test_sendto_ready_partial(self):
+        self.sock.sendmmsg.side_effect = [1, BlockingIOError]
+
+        transport = self.datagram_transport()
+        transport._buffer.append((b'data1', ()))
+        transport._buffer.append((b'data2', ()))
+        transport._buffer_size = 10
+        self.loop._add_writer(7, transport._sendto_ready)
+        transport._sendto_ready()
+
+        self.loop.assert_writer(7, transport._sendto_ready)
+        self.assertEqual([(b'data2', ())], list(transport._buffer))
+        self.assertEqual(transport.get_write_buffer_size(), 5)
+
+    def test_sendto_ready_error_received(self):
+        err = self.sock.sendmmsg.side_effect = ConnectionRefusedError()
+
+        transport = self.datagram_transport()
+        transport._fatal_error = mock.Mock()
+        transport._buffer.append((b'data1', ()))
+        transport._buffer.append((b'data2', ()))
+        transport._sendto_ready()
+
+        self.assertFalse(transport._fatal_error.called)
+        self.protocol.error_received.assert_called_with(err)
+        self.assertEqual([(b'data2', ())], list(transport._buffer))
+
+    def test_sendto_ready_exception(self):
+        err = self.sock.sendmmsg.side_effect = RuntimeError()
+
+        transport = self.datagram_transport()
+        transport._fatal_error = mock.Mock()
+        transport._buffer.append((b'data', ()))
+        transport._sendto_ready()
+
+        transport._fatal_error.assert_called_with(
+                                   err,
+                                   'Fatal write error on datagram transport')
+
+
 if __name__ == '__main__':
     unittest.main()
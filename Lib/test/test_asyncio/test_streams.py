@@ -861,6 +861,33 @@ def test_streamreaderprotocol_constructor_use_global_loop(self):
         protocol = asyncio.StreamReaderProtocol(reader)
         self.assertIs(protocol._loop, self.loop)
 
+    def test_streamreaderprotocol_buffer_updated(self):
+        reader = asyncio.StreamReader(loop=self.loop)
+        protocol = asyncio.StreamReaderProtocol(reader, loop=self.loop)
+        self.assertIsInstance(protocol, asyncio.BufferedProtocol)
+        buf = protocol.get_buffer(-1)
+        buf[:5] = b'line1'
+        protocol.buffer_updated(5)
+        # The buffer is reused for the next read.
+        self.assertIs(protocol.get_buffer(-1), buf)
+        buf[:7] = b'\nline2\n'
+        protocol.buffer_updated(7)
+        self.assertEqual(reader._buffer, b'line1\nline2\n')
+
+    def test_streamreaderprotocol_buffer_updated_subclass(self):
+        received = []
+        class Protocol(asyncio.StreamReaderProtocol):
+            def data_received(self, data):
+                received.append(data)
+        protocol = Protocol(mock.Mock(), loop=self.loop)
+        buf = protocol.get_buffer(-1)
+        buf[:4] = b'data'
+        protocol.buffer_updated(4)
+        buf[:4] = b'more'
+        protocol.buffer_updated(4)
+        self.assertEqual(received, [b'data', b'more'])
+        self.assertIs(type(received[0]), bytes)
+
     def test_multiple_drain(self):
         # See https://github.com/python/cpython/issues/74116
         drained = 0
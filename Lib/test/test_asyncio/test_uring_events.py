@@ -0,0 +1,352 @@
+import errno
+import os
+import select
+import socket
+import sys
+import tempfile
+import threading
+import unittest
+from unittest import mock
+
+if sys.platform != 'linux':
+    raise unittest.SkipTest('Linux only')
+
+import asyncio
+from asyncio import uring_events
+from test import support
+from test.support import import_helper
+from test.test_asyncio import utils as test_utils
+
+_uring = import_helper.import_module('_uring')
+try:
+    _uring.Ring(1).close()
+except OSError as exc:
+    raise unittest.SkipTest(f'io_uring is not supported: {exc}')
+
+
+def tearDownModule():
+    asyncio.set_event_loop_policy(None)
+
+
+class RingTests(unittest.TestCase):
+
+    def setUp(self):
+        self.ring = _uring.Ring(8)
+        self.addCleanup(self.ring.close)
+
+    def socketpair(self):
+        a, b = socket.socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+        return a, b
+
+    def test_create(self):
+        self.assertGreater(self.ring.fileno(), 0)
+        self.assertFalse(os.get_inheritable(self.ring.fileno()))
+        self.assertFalse(self.ring.closed)
+        self.assertEqual(self.ring.inflight, 0)
+        self.assertRaises(ValueError, _uring.Ring, 0)
+        self.assertRaises(ValueError, _uring.Ring, -1)
+
+    def test_close(self):
+        a, b = self.socketpair()
+        buf = bytearray(10)
+        self.ring.recv(a.fileno(), buf, 0)
+        self.assertEqual(self.ring.inflight, 1)
+        # the operation in flight is cancelled and waited for
+        self.ring.close()
+        self.assertTrue(self.ring.closed)
+        self.assertEqual(self.ring.inflight, 0)
+        buf.append(0)  # the buffer is released
+
+        # close() can be called more than once
+        self.ring.close()
+        self.assertRaises(ValueError, self.ring.fileno)
+        self.assertRaises(ValueError, self.ring.recv, a.fileno(), buf, 0)
+        self.assertRaises(ValueError, self.ring.send, a.fileno(), b'x', 0)
+        self.assertRaises(ValueError, self.ring.accept, a.fileno(), 0)
+        self.assertRaises(ValueError, self.ring.poll, a.fileno(), 0)
+        self.assertRaises(ValueError, self.ring.cancel, 1)
+        self.assertRaises(ValueError, self.ring.submit)
+        self.assertRaises(ValueError, self.ring.wait, 0)
+
+    def test_close_many(self):
+        # more operations in flight than cancellations fit in the
+        # submission queue
+        a, b = self.socketpair()
+        bufs = [bytearray(1) for _ in range(50)]
+        for buf in bufs:
+            self.ring.recv(a.fileno(), buf, 0)
+        self.assertEqual(self.ring.inflight, 50)
+        self.ring.close()
+        self.assertEqual(self.ring.inflight, 0)
+        for buf in bufs:
+            buf.append(0)
+
+    def test_recv_send(self):
+        a, b = self.socketpair()
+        buf = bytearray(10)
+        recv = self.ring.recv(a.fileno(), buf, 0)
+        self.assertEqual(self.ring.wait(0), [])
+        send = self.ring.send(b.fileno(), b'hello', 0)
+        self.assertNotEqual(recv, send)
+        results = []
+        while len(results) < 2:
+            results += self.ring.wait(support.SHORT_TIMEOUT)
+        self.assertEqual(sorted(results), sorted([(recv, 5), (send, 5)]))
+        self.assertEqual(buf, b'hello' + bytes(5))
+
+    def test_buffer_exported(self):
+        a, b = self.socketpair()
+        buf = bytearray(10)
+        op = self.ring.recv(a.fileno(), buf, 0)
+        with self.assertRaises(BufferError):
+            buf.append(0)
+        self.ring.cancel(op)
+        self.ring.wait(support.SHORT_TIMEOUT)
+        buf.append(0)
+        self.assertRaises(BufferError, self.ring.recv, a.fileno(), b'x', 0)
+
+    def test_read_write(self):
+        with tempfile.TemporaryFile() as f:
+            op = self.ring.write(f.fileno(), b'abcdef', 0)
+            self.assertEqual(self.ring.wait(support.SHORT_TIMEOUT), [(op, 6)])
+            buf = bytearray(3)
+            op = self.ring.read(f.fileno(), buf, 2)
+            self.assertEqual(self.ring.wait(support.SHORT_TIMEOUT), [(op, 3)])
+            self.assertEqual(buf, b'cde')
+            # offset -1 uses and updates the file position
+            op = self.ring.read(f.fileno(), buf, -1)
+            self.assertEqual(self.ring.wait(support.SHORT_TIMEOUT), [(op, 3)])
+            self.assertEqual(buf, b'abc')
+            self.assertEqual(f.tell(), 3)
+
+    def test_accept_poll(self):
+        with socket.create_server(('127.0.0.1', 0)) as listener:
+            op = self.ring.accept(listener.fileno(), socket.SOCK_CLOEXEC)
+            with socket.create_connection(listener.getsockname()) as client:
+                [(res_op, fd)] = self.ring.wait(support.SHORT_TIMEOUT)
+                self.assertEqual(res_op, op)
+                with socket.socket(fileno=fd) as conn:
+                    op = self.ring.poll(conn.fileno(), select.POLLIN)
+                    client.send(b'x')
+                    self.assertEqual(self.ring.wait(support.SHORT_TIMEOUT),
+                                     [(op, select.POLLIN)])
+
+    def test_errors(self):
+        op = self.ring.recv(-1, bytearray(1), 0)
+        self.assertEqual(self.ring.wait(support.SHORT_TIMEOUT),
+                         [(op, -errno.EBADF)])
+        with tempfile.TemporaryFile() as f:
+            op = self.ring.recv(f.fileno(), bytearray(1), 0)
+            self.assertEqual(self.ring.wait(support.SHORT_TIMEOUT),
+                             [(op, -errno.ENOTSOCK)])
+
+    def test_cancel(self):
+        a, b = self.socketpair()
+        op = self.ring.recv(a.fileno(), bytearray(1), 0)
+        self.assertTrue(self.ring.cancel(op))
+        self.assertEqual(self.ring.wait(support.SHORT_TIMEOUT),
+                         [(op, -errno.ECANCELED)])
+        # the operation is not in flight anymore
+        self.assertFalse(self.ring.cancel(op))
+
+    def test_submission_queue_full(self):
+        a, b = self.socketpair()
+        # the submissions are flushed to the kernel to make room
+        ops = [self.ring.recv(a.fileno(), bytearray(1), 0) for _ in range(20)]
+        self.assertEqual(self.ring.inflight, 20)
+        self.assertEqual(self.ring.submit(), 0)
+        for op in ops:
+            self.ring.cancel(op)
+        results = []
+        while len(results) < 20:
+            results += self.ring.wait(support.SHORT_TIMEOUT)
+        self.assertEqual(sorted(results),
+                         [(op, -errno.ECANCELED) for op in ops])
+
+    def test_wait_timeout(self):
+        self.assertEqual(self.ring.wait(0), [])
+        self.assertEqual(self.ring.wait(0.01), [])
+        self.assertRaises(ValueError, self.ring.wait, -1)
+
+
+class IoUringProactorTests(test_utils.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.loop = uring_events.IoUringEventLoop()
+        self.set_event_loop(self.loop)
+
+    def socketpair(self):
+        a, b = socket.socketpair()
+        a.setblocking(False)
+        b.setblocking(False)
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+        return a, b
+
+    def test_close(self):
+        a, b = self.socketpair()
+        trans = self.loop._make_socket_transport(a, asyncio.Protocol())
+        f = self.loop.create_task(self.loop.sock_recv(b, 100))
+        trans.close()
+        self.loop.run_until_complete(f)
+        self.assertEqual(f.result(), b'')
+
+    def test_close_pending(self):
+        # close() cancels the operations in flight and waits for them
+        a, b = self.socketpair()
+        f = self.loop._proactor.recv(b, 100)
+        test_utils.run_briefly(self.loop)
+        proactor = self.loop._proactor
+        self.assertEqual(len(proactor._cache), 2)  # with the self-pipe
+        self.close_loop(self.loop)
+        self.assertTrue(f.cancelled())
+        self.assertEqual(proactor._cache, {})
+        self.assertTrue(proactor._ring is None)
+
+    def test_sendall_large(self):
+        # send() may send only a part of the data
+        a, b = self.socketpair()
+        data = os.urandom(4 * 1024 * 1024)
+        send = self.loop.create_task(self.loop.sock_sendall(a, data))
+
+        async def recv_all():
+            chunks = []
+            size = 0
+            while size < len(data):
+                chunk = await self.loop.sock_recv(b, 65536)
+                chunks.append(chunk)
+                size += len(chunk)
+            return b''.join(chunks)
+
+        self.assertEqual(self.loop.run_until_complete(recv_all()), data)
+        self.assertIsNone(self.loop.run_until_complete(send))
+
+    def test_sock_recv_error(self):
+        with tempfile.TemporaryFile() as f:
+            with self.assertRaises(OSError) as cm:
+                self.loop.run_until_complete(self.loop.sock_recv(f, 1))
+            self.assertEqual(cm.exception.errno, errno.ENOTSOCK)
+
+    def test_sock_recv_cancel(self):
+        a, b = self.socketpair()
+        f = self.loop.create_task(self.loop.sock_recv(b, 100))
+        test_utils.run_briefly(self.loop)
+        f.cancel()
+        self.assertRaises(asyncio.CancelledError,
+                          self.loop.run_until_complete, f)
+        # the data is received by the next operation
+        a.send(b'data')
+        self.assertEqual(
+            self.loop.run_until_complete(self.loop.sock_recv(b, 100)),
+            b'data')
+
+    def test_sock_accept_cancel(self):
+        with socket.create_server(('127.0.0.1', 0)) as listener:
+            listener.setblocking(False)
+            f = self.loop.create_task(self.loop.sock_accept(listener))
+            test_utils.run_briefly(self.loop)
+            f.cancel()
+            self.assertRaises(asyncio.CancelledError,
+                              self.loop.run_until_complete, f)
+
+    def test_sock_connect_refused(self):
+        with socket.create_server(('127.0.0.1', 0)) as listener:
+            address = listener.getsockname()
+        with socket.socket() as sock:
+            sock.setblocking(False)
+            with self.assertRaises(ConnectionRefusedError):
+                self.loop.run_until_complete(
+                    self.loop.sock_connect(sock, address))
+
+    def test_pread_pwrite(self):
+        with tempfile.TemporaryFile() as f:
+            n = self.loop.run_until_complete(self.loop.pwrite(f, b'abcdef', 0))
+            self.assertEqual(n, 6)
+            self.assertEqual(
+                self.loop.run_until_complete(self.loop.pread(f, 3, 2)),
+                b'cde')
+            self.assertEqual(
+                self.loop.run_until_complete(
+                    self.loop.pread(f.fileno(), 100, 4)),
+                b'ef')
+            # the file position is not changed
+            self.assertEqual(f.tell(), 0)
+
+    def test_sock_sendfile(self):
+        a, b = self.socketpair()
+        with tempfile.TemporaryFile() as f:
+            f.write(b'sendfile data')
+            f.seek(0)
+            # falls back to reading the file and sending the data
+            n = self.loop.run_until_complete(self.loop.sock_sendfile(a, f))
+        self.assertEqual(n, 13)
+        self.assertEqual(
+            self.loop.run_until_complete(self.loop.sock_recv(b, 100)),
+            b'sendfile data')
+
+    def test_call_soon_threadsafe(self):
+        results = []
+
+        def func():
+            results.append(threading.get_ident())
+            self.loop.stop()
+
+        thread = threading.Thread(
+            target=lambda: self.loop.call_soon_threadsafe(func))
+        self.loop.call_soon(thread.start)
+        self.loop.run_forever()
+        thread.join()
+        self.assertEqual(results, [threading.get_ident()])
+
+    def test_pipes_not_supported(self):
+        r, w = os.pipe()
+        with open(r, 'rb') as rf, open(w, 'wb') as wf:
+            with self.assertRaises(NotImplementedError):
+                self.loop.run_until_complete(
+                    self.loop.connect_read_pipe(asyncio.Protocol, rf))
+            with self.assertRaises(NotImplementedError):
+                self.loop.run_until_complete(
+                    self.loop.connect_write_pipe(asyncio.Protocol, wf))
+
+
+class NewEventLoopTests(unittest.TestCase):
+
+    def test_new_event_loop(self):
+        loop = uring_events.new_event_loop()
+        try:
+            self.assertIsInstance(loop, uring_events.IoUringEventLoop)
+        finally:
+            loop.close()
+
+    def test_fallback(self):
+        # A kernel without io_uring support
+        with mock.patch('_uring.Ring',
+                        side_effect=OSError(errno.ENOSYS, 'no io_uring')):
+            loop = uring_events.new_event_loop()
+        try:
+            self.assertIsInstance(loop, asyncio.SelectorEventLoop)
+        finally:
+            loop.close()
+
+        # _uring is not built
+        with mock.patch.object(uring_events, '_uring', None):
+            loop = uring_events.new_event_loop()
+        try:
+            self.assertIsInstance(loop, asyncio.SelectorEventLoop)
+        finally:
+            loop.close()
+
+    def test_run(self):
+        async def main():
+            return type(asyncio.get_running_loop())
+
+        self.assertIs(asyncio.run(main(),
+                                  loop_factory=uring_events.new_event_loop),
+                      uring_events.IoUringEventLoop)
+
+
+if __name__ == '__main__':
+    unittest.main()
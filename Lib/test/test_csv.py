@@ -387,9 +387,12 @@ def test_read_bigfield(self):
             self._read_test([bigline], [[bigstring, bigstring]])
             csv.field_size_limit(size)
             self._read_test([bigline], [[bigstring, bigstring]])
+            self._read_test(['"%s"' % bigstring], [[bigstring]])
             self.assertEqual(csv.field_size_limit(), size)
             csv.field_size_limit(size-1)
             self.assertRaises(csv.Error, self._read_test, [bigline], [])
+            self.assertRaises(csv.Error, self._read_test,
+                              ['"%s"' % bigstring], [])
             self.assertRaises(TypeError, csv.field_size_limit, None)
             self.assertRaises(TypeError, csv.field_size_limit, 1, None)
         finally:
@@ -407,6 +410,21 @@ def test_read_linenum(self):
         self.assertRaises(StopIteration, next, r)
         self.assertEqual(r.line_num, 3)
 
+    def test_read_nonascii(self):
+        # One-byte and wider strings take different paths in the reader
+        lines = ['ab,"c,d", e\\f,,"g""h"\r\n', 'i\\,j,"k', 'l",m n\n', ' o,p']
+        for kwargs in ({}, {'escapechar': '\\'}, {'skipinitialspace': True},
+                       {'quoting': csv.QUOTE_NONE, 'escapechar': '\\'},
+                       {'delimiter': ' '}):
+            with self.subTest(**kwargs):
+                expect = list(csv.reader(lines, **kwargs))
+                for wide in '\xe9', '\u20ac', '\U0001f600':
+                    trans = str.maketrans('abgkmo', wide * 6)
+                    result = list(csv.reader([l.translate(trans) for l in lines],
+                                             **kwargs))
+                    self.assertEqual(result, [[f.translate(trans) for f in row]
+                                              for row in expect])
+
     def test_roundtrip_quoteed_newlines(self):
         with TemporaryFile("w+", encoding="utf-8", newline='') as fileobj:
             writer = csv.writer(fileobj)
@@ -21,6 +21,7 @@
 """
 Tests for epoll wrapper.
 """
+import array
 import errno
 import os
 import select
@@ -213,6 +214,55 @@ def test_control_and_wait(self):
         expected = [(server.fileno(), select.EPOLLOUT)]
         self.assertEqual(events, expected)
 
+    def test_poll_into(self):
+        client, server = self._connected_pair()
+        ep = select.epoll(16)
+        self.addCleanup(ep.close)
+        ep.register(server.fileno(), select.EPOLLIN | select.EPOLLOUT)
+        ep.register(client.fileno(), select.EPOLLIN | select.EPOLLOUT)
+
+        buf = array.array('Q', [0] * 8)
+        n = ep.poll_into(buf, 1)
+        self.assertEqual(n, 2)
+        events = list(zip(buf[0:2*n:2], buf[1:2*n:2]))
+        expected = [(client.fileno(), select.EPOLLOUT),
+                    (server.fileno(), select.EPOLLOUT)]
+        self.assertEqual(sorted(events), sorted(expected))
+
+        # the number of events is limited by the size of the buffer
+        small = array.array('Q', [0] * 2)
+        self.assertEqual(ep.poll_into(small, 1), 1)
+        self.assertIn(tuple(small), expected)
+
+        # other buffers of unsigned 64-bit integers are accepted
+        view = memoryview(bytearray(32)).cast('Q')
+        self.assertEqual(ep.poll_into(view, 1), 2)
+        self.assertEqual(sorted(zip(view[0::2], view[1::2])), sorted(expected))
+        if array.array('L').itemsize == 8:
+            self.assertEqual(ep.poll_into(array.array('L', [0] * 4), 1), 2)
+
+        # no event
+        ep.unregister(client.fileno())
+        ep.unregister(server.fileno())
+        self.assertEqual(ep.poll_into(buf, 0.1), 0)
+
+    def test_poll_into_errors(self):
+        ep = select.epoll()
+        self.addCleanup(ep.close)
+        self.assertRaises(TypeError, ep.poll_into, b'x' * 16)
+        self.assertRaises(ValueError, ep.poll_into, bytearray(16))
+        self.assertRaises(ValueError, ep.poll_into, array.array('I', [0] * 4))
+        self.assertRaises(ValueError, ep.poll_into, array.array('Q', [0]))
+        # 64-bit items which are not unsigned integers are rejected
+        self.assertRaises(ValueError, ep.poll_into, array.array('d', [0] * 4))
+        self.assertRaises(ValueError, ep.poll_into, array.array('q', [0] * 4))
+        self.assertRaises(ValueError, ep.poll_into,
+                          memoryview(bytearray(32)).cast('d'))
+        self.assertRaises(TypeError, ep.poll_into,
+                          memoryview(array.array('Q', [0] * 8))[::2])
+        ep.close()
+        self.assertRaises(ValueError, ep.poll_into, array.array('Q', [0] * 2))
+
     def test_errors(self):
         self.assertRaises(ValueError, select.epoll, -2)
         self.assertRaises(ValueError, select.epoll().register, -1,
@@ -827,6 +827,46 @@ def test_short_repr(self):
             self.assertEqual(repr(float(s)), str(float(s)))
             self.assertEqual(repr(float(negs)), str(float(negs)))
 
+    @unittest.skipUnless(getattr(sys, 'float_repr_style', '') == 'short',
+                         "applies only when using short float repr style")
+    def test_shortest_repr(self):
+        # repr() gives the shortest string that round-trips, and the one
+        # closest to the value if there are several.
+        from decimal import Decimal
+
+        def check(x):
+            exact = Decimal(x)
+            for prec in range(17):
+                # The candidates are the correctly rounded value and its
+                # neighbours (the rounding interval of a power of two is
+                # not symmetric).
+                nearest = Decimal('%.*e' % (prec, x))
+                step = Decimal(1).scaleb(nearest.adjusted() - prec)
+                candidates = [c for c in (nearest - step, nearest,
+                                          nearest + step)
+                              if float(c) == x]
+                if candidates:
+                    break
+            # Ties go to the even digit.
+            expected = min(candidates,
+                           key=lambda c: (abs(c - exact),
+                                          c.as_tuple().digits[-1] % 2))
+            self.assertEqual(Decimal(repr(x)), expected, x)
+
+        values = [5e-324, 1e-323, 2.2250738585072014e-308,
+                  2.225073858507201e-308, 1.7976931348623157e+308,
+                  1e23, 9.999999999999999e22, 8.41e21, 5.0e-310,
+                  2.0 ** 63, 2.0 ** 64, 2.0 ** -1022, 0.1, 0.3, 1 / 3]
+        rng = random.Random(12345)
+        for _ in range(2000):
+            values.append(struct.unpack('<d', rng.randbytes(8))[0])
+            values.append(rng.random() * 10 ** rng.randint(-320, 308))
+            values.append(2.0 ** rng.randint(-1074, 1023))
+        for x in values:
+            if math.isfinite(x) and x:
+                check(x)
+                check(-x)
+
 @support.requires_IEEE_754
 class RoundTestCase(unittest.TestCase):
 
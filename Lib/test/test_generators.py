@@ -108,6 +108,34 @@ def g3(): return (yield from f())
                 gen.send(2)
             self.assertEqual(cm.exception.value, 2)
 
+    def test_finalize_reused(self):
+        # Deallocated generators are kept on a freelist and reused for
+        # generators and coroutines with the same frame size. Each new
+        # object must still be finalized.
+        finalized = []
+        def gen():
+            try:
+                yield
+            finally:
+                finalized.append("gen")
+        async def coro():
+            try:
+                await Awaitable()
+            finally:
+                finalized.append("coro")
+        class Awaitable:
+            def __await__(self):
+                yield
+
+        for i in range(3):
+            g = gen()
+            next(g)
+            del g
+            c = coro()
+            c.send(None)
+            del c
+        self.assertEqual(finalized, ["gen", "coro"] * 3)
+
 
 class GeneratorTest(unittest.TestCase):
 
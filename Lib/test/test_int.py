@@ -822,8 +822,9 @@ class IntSubclassStrDigitLimitsTests(IntStrDigitLimitsTests):
 
 
 class PyLongModuleTests(unittest.TestCase):
-    # Tests of the functions in _pylong.py.  Those get used when the
-    # number of digits in the input values are large enough.
+    # Tests of the functions in _pylong.py and of the subquadratic
+    # algorithms in longobject.c.  Those get used when the number of
+    # digits in the input values are large enough.
 
     def setUp(self):
         super().setUp()
@@ -851,6 +852,27 @@ def test_pylong_int_divmod(self):
         a, b = divmod(n*3 + 1, n)
         assert a == 3 and b == 1
 
+    @unittest.skipUnless(_pylong, "_pylong module required")
+    def test_subquadratic_conversions(self):
+        # Sizes around the thresholds and recursion cutoffs of the C
+        # algorithms, checked against _pylong.
+        for bits in (9_000, 9_001, 12_000, 40_000, 83_000, 83_100,
+                     100_000, 300_000):
+            for n in ((1 << bits) - 1, 1 << bits, 7 ** (bits // 3)):
+                s = str(n)
+                self.assertEqual(s, _pylong.int_to_decimal_string(n))
+                self.assertEqual(str(-n), '-' + s)
+                self.assertEqual(int(s), n)
+                self.assertEqual(int('-' + s), -n)
+                self.assertEqual(int('000' + s), n)
+                self.assertEqual(int(s[:1] + '_' + s[1:]), n)
+        for digits in (5_999, 6_001, 20_000, 24_999, 25_001, 100_000):
+            s = '0' * digits
+            self.assertEqual(int(s), 0)
+            self.assertEqual(int(s + '5'), 5)
+            self.assertEqual(int('-' + s + '5'), -5)
+            self.assertEqual(int('1' + s), 10 ** digits)
+
     def test_pylong_str_to_int(self):
         v1 = 1 << 100_000
         s = str(v1)
@@ -872,8 +894,8 @@ def test_pylong_str_to_int(self):
     @mock.patch.object(_pylong, "int_to_decimal_string")
     def test_pylong_misbehavior_error_path_to_str(
             self, mock_int_to_str):
-        with support.adjust_int_max_str_digits(20_000):
-            big_value = int('7'*19_999)
+        with support.adjust_int_max_str_digits(200_000):
+            big_value = int('7'*199_999)
             mock_int_to_str.return_value = None  # not a str
             with self.assertRaises(TypeError) as ctx:
                 str(big_value)
@@ -888,8 +910,8 @@ def test_pylong_misbehavior_error_path_to_str(
     @mock.patch.object(_pylong, "int_from_string")
     def test_pylong_misbehavior_error_path_from_str(
             self, mock_int_from_str):
-        big_value = '7'*19_999
-        with support.adjust_int_max_str_digits(20_000):
+        big_value = '7'*199_999
+        with support.adjust_int_max_str_digits(200_000):
             mock_int_from_str.return_value = b'not an int'
             with self.assertRaises(TypeError) as ctx:
                 int(big_value)
@@ -1705,6 +1705,25 @@ def test_garbage_collection(self):
             support.gc_collect()
         self.assertIsNone(wr(), wr)
 
+    def test_large_buffer_sequential_read(self):
+        # Sequential reads with a large buffer ask the OS to prefetch the
+        # next chunk; make sure seeking in between doesn't confuse them.
+        data = bytes(range(256)) * (4 * 1024)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with self.FileIO(os_helper.TESTFN, "wb") as f:
+            f.write(data)
+        bufsize = 128 * 1024
+        with self.tp(self.FileIO(os_helper.TESTFN, "rb"), bufsize) as bufio:
+            chunks = []
+            while chunk := bufio.read(bufsize // 2):
+                chunks.append(chunk)
+            self.assertEqual(b"".join(chunks), data)
+            bufio.seek(1000)
+            self.assertEqual(bufio.read(3 * bufsize),
+                             data[1000:1000 + 3 * bufsize])
+            bufio.seek(0)
+            self.assertEqual(bufio.read(), data)
+
     def test_args_error(self):
         # Issue #17275
         with self.assertRaisesRegex(TypeError, "BufferedReader"):
@@ -2984,6 +3003,21 @@ def test_newlines_input(self):
             txt.seek(0)
             self.assertEqual(txt.read(), "".join(expected))
 
+    def test_newlines_input_long_lines(self):
+        # Line endings far from the start of the line, and \r\n pairs
+        # straddling every position of a block boundary.
+        lines = []
+        for n in range(250, 520, 7):
+            lines += ["a" * n + "\r\n", "b" * n + "\r", "c" * n + "\n"]
+        testdata = "".join(lines).encode("ascii")
+        for newline, expected in [
+            ("", lines),
+            (None, [l.rstrip("\r\n") + "\n" for l in lines]),
+            ]:
+            buf = self.BytesIO(testdata)
+            txt = self.TextIOWrapper(buf, encoding="ascii", newline=newline)
+            self.assertEqual(txt.readlines(), expected)
+
     def test_newlines_output(self):
         testdict = {
             "": b"AAA\nBBB\nCCC\nX\rY\r\nZ",
@@ -4151,6 +4185,60 @@ def test___all__(self):
                              extra=self.extra_exported,
                              not_exported=self.not_exported)
 
+    def test_open_mapped(self):
+        import json, re
+        data = b'{"spam": [1, 2, 3]}'
+        with self.open(os_helper.TESTFN, "wb") as f:
+            f.write(data)
+        m = self.io.open_mapped(os_helper.TESTFN)
+        try:
+            self.assertEqual(m[:], data)
+            with memoryview(m) as view:
+                self.assertTrue(view.readonly)
+                self.assertEqual(bytes(view), data)
+                self.assertRaises(TypeError, view.__setitem__, 0, 0)
+            self.assertEqual(re.search(rb"\[(.*)\]", m).group(1), b"1, 2, 3")
+            self.assertEqual(json.loads(m), {"spam": [1, 2, 3]})
+        finally:
+            m.close()
+
+        payload = pickle.dumps(list(range(100)))
+        with self.open(os_helper.TESTFN, "wb") as f:
+            f.write(payload)
+        m = self.io.open_mapped(os_helper.TESTFN)
+        try:
+            self.assertEqual(pickle.loads(m), list(range(100)))
+        finally:
+            m.close()
+
+    def test_open_mapped_replaced(self):
+        # The mapping keeps the original contents if the file is replaced.
+        other = os_helper.TESTFN + "2"
+        self.addCleanup(os_helper.unlink, other)
+        with self.open(os_helper.TESTFN, "wb") as f:
+            f.write(b"old contents")
+        with self.open(other, "wb") as f:
+            f.write(b"new")
+        m = self.io.open_mapped(os_helper.TESTFN)
+        os.replace(other, os_helper.TESTFN)
+        self.assertEqual(bytes(m), b"old contents")
+        if hasattr(m, "close"):
+            m.close()
+
+    def test_open_mapped_not_mappable(self):
+        # Empty files and pipes are read into a bytes object.
+        with self.open(os_helper.TESTFN, "wb"):
+            pass
+        self.assertEqual(self.io.open_mapped(os_helper.TESTFN), b"")
+
+        r, w = os.pipe()
+        self.addCleanup(os.close, r)
+        os.write(w, b"data")
+        os.close(w)
+        self.assertEqual(self.io.open_mapped(r), b"data")
+        # The file descriptor is not closed.
+        os.fstat(r)
+
     def test_attributes(self):
         f = self.open(os_helper.TESTFN, "wb", buffering=0)
         self.assertEqual(f.mode, "wb")
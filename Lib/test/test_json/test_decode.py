@@ -16,6 +16,21 @@ def test_float(self):
         self.assertTrue(isinstance(rval, float))
         self.assertEqual(rval, 1.0)
 
+    def test_numbers(self):
+        for s in ['0', '-0', '7', '-7', '123456789012345678',
+                  '-12345678901234567', '999999999999999999',
+                  '-999999999999999999', '1234567890123456789',
+                  '-9223372036854775808', '9223372036854775808',
+                  '1' * 70, '-' + '9' * 100]:
+            with self.subTest(s):
+                self.assertEqual(self.loads(s), int(s))
+                self.assertEqual(self.loads(f'[{s}]'), [int(s)])
+        for s in ['0.0', '-0.5', '1e3', '1E-3', '-1.5e+300', '1e400',
+                  '-1e400', '0.' + '1' * 80, '4.9e-324', '1.7976931348623157e308']:
+            with self.subTest(s):
+                self.assertEqual(self.loads(s), float(s))
+        self.assertEqual(str(self.loads('-0.0')), '-0.0')
+
     def test_empty_objects(self):
         self.assertEqual(self.loads('{}'), {})
         self.assertEqual(self.loads('[]'), [])
@@ -63,6 +78,25 @@ def test_keys_reuse(self):
         self.check_keys_reuse(s, decoder.decode)
         self.assertFalse(decoder.memo)
 
+    def test_key_cache_size(self):
+        def keys(decoder, doc):
+            return list(decoder.decode(doc))
+
+        decoder = self.json.decoder.JSONDecoder()
+        self.assertIsNot(keys(decoder, '{"spam": 1}')[0],
+                         keys(decoder, '{"spam": 2}')[0])
+
+        decoder = self.json.decoder.JSONDecoder(key_cache_size=2)
+        spam, ham = keys(decoder, '{"spam": 1, "ham": [{"spam": 2}]}')
+        self.assertIs(keys(decoder, '{"spam": 3}')[0], spam)
+        self.assertIs(keys(decoder, '{"ham": 4}')[0], ham)
+        # Exceeding the size empties the cache.
+        keys(decoder, '{"eggs": 5}')
+        self.assertIsNot(keys(decoder, '{"spam": 6}')[0], spam)
+
+        self.assertRaises(ValueError, self.json.decoder.JSONDecoder,
+                          key_cache_size=-1)
+
     def test_extra_data(self):
         s = '[1, 2, 3]5'
         msg = 'Extra data'
@@ -9,6 +9,32 @@ def test_dump(self):
         self.json.dump({}, sio)
         self.assertEqual(sio.getvalue(), '{}')
 
+    def test_dump_chunked(self):
+        obj = [{'key': 'x' * 100, 'list': [i, None, 1.5]} for i in range(1000)]
+        chunks = []
+        class Writer:
+            def write(self, s):
+                chunks.append(s)
+        self.json.dump(obj, Writer())
+        self.assertGreater(len(chunks), 1)
+        self.assertEqual(''.join(chunks), self.dumps(obj))
+
+        # Errors raised by write() are propagated.
+        class BadWriter:
+            def write(self, s):
+                1/0
+        with self.assertRaises(ZeroDivisionError):
+            self.json.dump(obj, BadWriter())
+
+    def test_dump_custom_iterencode(self):
+        class Encoder(self.json.JSONEncoder):
+            def iterencode(self, o):
+                yield from super().iterencode(o)
+                yield ' '
+        sio = StringIO()
+        self.json.dump([1, 2], sio, cls=Encoder)
+        self.assertEqual(sio.getvalue(), '[1, 2] ')
+
     def test_dumps(self):
         self.assertEqual(self.dumps({}), '{}')
 
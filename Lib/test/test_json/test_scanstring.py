@@ -132,6 +132,28 @@ def test_bad_escapes(self):
             with self.assertRaises(self.JSONDecodeError, msg=s):
                 scanstring(s, 1, True)
 
+    def test_long_strings(self):
+        # Special characters found at every offset within a word-sized
+        # block, including the partial block at the end of the input.
+        scanstring = self.json.decoder.scanstring
+        for n in range(20):
+            prefix = 'x' * n
+            with self.subTest(n=n):
+                self.assertEqual(scanstring(f'"{prefix}"', 1, True),
+                                 (prefix, n + 2))
+                self.assertEqual(scanstring(f'"{prefix}\\n\xe9"', 1, True),
+                                 (prefix + '\n\xe9', n + 5))
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    scanstring(f'"{prefix}\x1fabcdefgh"', 1, True)
+                self.assertTrue(cm.exception.msg.startswith(
+                    'Invalid control character'))
+                self.assertEqual(scanstring(f'"{prefix}\x1f\x80"', 1, False),
+                                 (prefix + '\x1f\x80', n + 4))
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    scanstring(f'"{prefix}\x7f\xff', 1, True)
+                self.assertEqual(cm.exception.msg,
+                                 'Unterminated string starting at')
+
     def test_overflow(self):
         with self.assertRaises(OverflowError):
             self.json.decoder.scanstring(b"xxx", sys.maxsize+1)
@@ -28,6 +28,20 @@ def test(value):
         self.assertRaises(ZeroDivisionError, test, '""')
         self.assertRaises(ZeroDivisionError, test, '{}')
 
+    def test_scan_utf8_bytes(self):
+        scan_once = self.json.decoder.JSONDecoder().scan_once
+        self.assertEqual(scan_once(b'["\xc3\xa9", 1] ', 0),
+                         (['\xe9', 1], 9))
+        # Errors are reported against the decoded document.
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            scan_once(b'["\xc3\xa9" 1]', 0)
+        self.assertEqual(cm.exception.doc, '["\xe9" 1]')
+        self.assertEqual(cm.exception.pos, 5)
+        with self.assertRaises(StopIteration):
+            scan_once(b'   ', 3)
+        self.assertRaises(UnicodeDecodeError, scan_once, b'"\xc3"', 0)
+        self.assertRaises(TypeError, scan_once, bytearray(b'1'), 0)
+
 
 class TestEncode(CTest):
     def test_make_encoder(self):
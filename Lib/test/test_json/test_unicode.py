@@ -1,3 +1,4 @@
+import array
 import codecs
 from collections import OrderedDict
 from test.test_json import PyTest, CTest
@@ -79,6 +80,43 @@ def test_bytes_decode(self):
         self.assertEqual(self.loads(b'\x007'), 7)
         self.assertEqual(self.loads(b'57'), 57)
 
+    def test_bytes_like_decode(self):
+        data = ["a\xb5\u20ac\U0001d120"]
+        for encoding in 'utf-8', 'utf-16le', 'utf-32be':
+            encoded = self.dumps(data).encode(encoding)
+            self.assertEqual(self.loads(memoryview(encoded)), data)
+            self.assertEqual(self.loads(array.array('b', encoded)), data)
+        self.assertEqual(self.loads(memoryview(b'5\x00')), 5)
+        self.assertEqual(self.loads(bytearray(b'[1]')), [1])
+        with self.assertRaisesRegex(TypeError,
+                'must be a contiguous buffer, not a non-contiguous memoryview'):
+            self.loads(memoryview(b'[1]')[::2])
+        with self.assertRaisesRegex(TypeError,
+                'must be str or a bytes-like object, not int'):
+            self.loads(1)
+
+    def test_utf8_bytes_decode(self):
+        # UTF-8 bytes decode to the same result as the equivalent str,
+        # and errors are reported with the same character positions.
+        for doc in ['{"\xe9t\xe9": ["\u20ac\\n\\u00e9", -1.5e3, 12, null]}',
+                    ' [true, false, "\U0001d120\\ud834\\udd20"] ',
+                    '"\ud800"', '{}', '[]', '0']:
+            with self.subTest(doc=doc):
+                encoded = doc.encode('utf-8', 'surrogatepass')
+                self.assertEqual(self.loads(encoded), self.loads(doc))
+        for doc in ['["\xe9\xe9", x]', '{"\u20ac": 1,}', '["\xe9" 1]',
+                    '"\xe9\x01"', '["\xe9"] ]', '["\xe9\\x"]', ' ']:
+            with self.subTest(doc=doc):
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    self.loads(doc)
+                with self.assertRaises(self.JSONDecodeError) as cm2:
+                    self.loads(doc.encode('utf-8'))
+                self.assertEqual(cm2.exception.msg, cm.exception.msg)
+                self.assertEqual(cm2.exception.pos, cm.exception.pos)
+                self.assertEqual(cm2.exception.doc, doc)
+        self.assertRaises(UnicodeDecodeError, self.loads, b'["\xe9", "\xff"]')
+        self.assertRaises(UnicodeDecodeError, self.loads, b'["\xe9", \xff]')
+
     def test_object_pairs_hook_with_unicode(self):
         s = '{"xkd":1, "kcw":2, "art":3, "hxm":4, "qrt":5, "pad":6, "hoy":7}'
         p = [("xkd", 1), ("kcw", 2), ("art", 3), ("hxm", 4),
@@ -641,6 +641,63 @@ def func2():
 
         self.check_lines(func2, [1,2,3,4,5,6])
 
+    def test_lines_keep_specialization(self):
+
+        def func(seq):
+            return len(seq)
+
+        def opnames():
+            return [instr.opname for instr in
+                    dis.get_instructions(func, adaptive=True)]
+
+        for _ in range(1025):
+            func(())
+        self.assertIn("LOAD_GLOBAL_BUILTIN", opnames())
+        try:
+            events = []
+            sys.monitoring.register_callback(TEST_TOOL, E.LINE,
+                                             RecorderWithDisable(events))
+            sys.monitoring.set_events(TEST_TOOL, E.LINE)
+            for _ in range(100):
+                self.assertEqual(func((1, 2)), 2)
+            sys.monitoring.set_events(TEST_TOOL, 0)
+            lineno = func.__code__.co_firstlineno + 1
+            self.assertEqual(events.count(lineno), 100)
+        finally:
+            sys.monitoring.set_events(TEST_TOOL, 0)
+            sys.monitoring.register_callback(TEST_TOOL, E.LINE, None)
+        # Instrumentation is removed lazily, the next time func() runs.
+        func(())
+        self.assertIn("LOAD_GLOBAL_BUILTIN", opnames())
+
+    def test_lines_specialization_misses(self):
+
+        def func():
+            return value
+
+        global value
+        value = 1
+        try:
+            for _ in range(1025):
+                self.assertEqual(func(), 1)
+            events = []
+            sys.monitoring.register_callback(TEST_TOOL, E.LINE,
+                                             RecorderWithDisable(events))
+            sys.monitoring.set_events(TEST_TOOL, E.LINE)
+            for i in range(1025):
+                value = i
+                self.assertEqual(func(), i)
+            sys.monitoring.set_events(TEST_TOOL, 0)
+            lineno = func.__code__.co_firstlineno + 1
+            self.assertEqual(events.count(lineno), 1025)
+            for i in range(1025):
+                value = -i
+                self.assertEqual(func(), -i)
+        finally:
+            sys.monitoring.set_events(TEST_TOOL, 0)
+            sys.monitoring.register_callback(TEST_TOOL, E.LINE, None)
+            del value
+
 class TestDisable(MonitoringTestBase, unittest.TestCase):
 
     def gen(self, cond):
@@ -1684,6 +1741,299 @@ def f():
     def test_get_local_events_uninitialized(self):
         self.assertEqual(sys.monitoring.get_local_events(TEST_TOOL, self.f.__code__), 0)
 
+def coverage_func(x):
+    if x:
+        y = 1
+    else:
+        y = 2
+    return y
+
+
+class TestNativeCoverage(MonitoringTestBase, unittest.TestCase):
+
+    func = staticmethod(coverage_func)
+
+    def get_coverage(self, code, records=None):
+        if records is None:
+            records = sys.monitoring.get_coverage()
+        key = (code.co_filename, code.co_qualname, code.co_firstlineno)
+        for filename, qualname, firstlineno, bitmap in records:
+            if (filename, qualname, firstlineno) == key:
+                return bitmap
+        self.fail(f"no coverage for {code}")
+
+    def get_bit(self, code, bitmap, index, offset):
+        # bitmap is made of the line, branch not taken and branch taken
+        # bitmaps, with one bit per code unit
+        size = (len(code.co_code) // 2 + 7) // 8
+        self.assertEqual(len(bitmap), 3 * size)
+        unit = offset // 2
+        return bitmap[index * size + unit // 8] >> (unit % 8) & 1
+
+    def covered_lines(self, code, records=None):
+        bitmap = self.get_coverage(code, records)
+        return sorted({
+            line - code.co_firstlineno
+            for start, end, line in code.co_lines()
+            if any(self.get_bit(code, bitmap, 0, offset)
+                   for offset in range(start, end, 2))
+        })
+
+    def branches(self, code):
+        # 2 for a branch not taken, 4 for a branch taken, 6 for both
+        bitmap = self.get_coverage(code)
+        branches = [
+            self.get_bit(code, bitmap, 1, offset) * 2 +
+            self.get_bit(code, bitmap, 2, offset) * 4
+            for offset in range(0, len(code.co_code), 2)
+        ]
+        return [flags for flags in branches if flags]
+
+    def test_lines(self):
+        sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+        try:
+            self.func(True)
+            self.func(True)
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+        self.assertEqual(self.covered_lines(self.func.__code__), [1, 2, 5])
+        self.assertEqual(self.branches(self.func.__code__), [])
+
+    def test_callbacks_not_called(self):
+        events = []
+        sys.monitoring.register_callback(TEST_TOOL, E.LINE, events.append)
+        sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+        try:
+            self.func(False)
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+            sys.monitoring.register_callback(TEST_TOOL, E.LINE, None)
+        self.assertEqual(events, [])
+        self.assertEqual(self.covered_lines(self.func.__code__), [1, 4, 5])
+
+    def test_branches(self):
+        sys.monitoring.start_coverage(TEST_TOOL, E.BRANCH)
+        try:
+            self.func(False)
+            self.assertEqual(self.branches(self.func.__code__), [4])
+            self.func(True)
+            self.assertEqual(self.branches(self.func.__code__), [6])
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+
+    def test_other_tools(self):
+        events = []
+        sys.monitoring.register_callback(TEST_TOOL2, E.LINE,
+                                         RecorderWithDisable(events))
+        sys.monitoring.set_events(TEST_TOOL2, E.LINE)
+        sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+        try:
+            self.func(True)
+            self.func(True)
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+            sys.monitoring.set_events(TEST_TOOL2, 0)
+            sys.monitoring.register_callback(TEST_TOOL2, E.LINE, None)
+        lineno = self.func.__code__.co_firstlineno
+        self.assertEqual(events.count(lineno + 1), 2)
+        self.assertEqual(self.covered_lines(self.func.__code__), [1, 2, 5])
+
+    def test_restart_discards_data(self):
+        sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+        try:
+            self.func(True)
+            sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+            self.func(False)
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+        self.assertEqual(self.covered_lines(self.func.__code__), [1, 4, 5])
+
+    def test_restart_other_tools_unaffected(self):
+        events = []
+        recorder = RecorderWithDisable(events)
+        recorder.disable = True
+        sys.monitoring.register_callback(TEST_TOOL2, E.LINE, recorder)
+        sys.monitoring.set_events(TEST_TOOL2, E.LINE)
+        lineno = self.func.__code__.co_firstlineno
+        def func_events():
+            return [line - lineno for line in events
+                    if lineno <= line < lineno + 6]
+        try:
+            self.func(True)
+            self.func(True)
+            self.assertEqual(func_events(), [1, 2, 5])
+            sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+            try:
+                self.func(True)
+            finally:
+                sys.monitoring.stop_coverage(TEST_TOOL)
+        finally:
+            sys.monitoring.set_events(TEST_TOOL2, 0)
+            sys.monitoring.register_callback(TEST_TOOL2, E.LINE, None)
+        # The lines disabled by TEST_TOOL2 stay disabled
+        self.assertEqual(func_events(), [1, 2, 5])
+        self.assertEqual(self.covered_lines(self.func.__code__), [1, 2, 5])
+
+    def test_code_not_kept_alive(self):
+        import weakref
+        from test.support import gc_collect
+        ns = {}
+        exec(textwrap.dedent("""
+            def f():
+                return 1
+        """), ns)
+        code_ref = weakref.ref(ns["f"].__code__)
+        sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+        try:
+            ns["f"]()
+            records = sys.monitoring.get_coverage()
+            self.assertEqual(self.covered_lines(code_ref(), records), [1])
+            ns.clear()
+            gc_collect()
+            self.assertIsNone(code_ref())
+            self.func(True)
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+        # The coverage of the freed code object is kept
+        def f_records(records):
+            return [r for r in records if r[:2] == ("<string>", "f")]
+        self.assertEqual(f_records(sys.monitoring.get_coverage()),
+                         f_records(records))
+        self.assertEqual(len(f_records(records)), 1)
+        self.assertEqual(self.covered_lines(self.func.__code__), [1, 2, 5])
+
+    def test_module_and_class_bodies(self):
+        import weakref
+        from test.support import gc_collect
+        source = textwrap.dedent("""
+            x = 1
+            class C:
+                y = 2
+        """)
+        def class_code(module_code):
+            [code] = [c for c in module_code.co_consts
+                      if isinstance(c, types.CodeType)]
+            return code
+        module_code = compile(source, "<coverage>", "exec")
+        code_ref = weakref.ref(class_code(module_code))
+        sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+        try:
+            exec(module_code, {})
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+        del module_code
+        gc_collect()
+        self.assertIsNone(code_ref())
+        # Both code objects were freed, their coverage is kept
+        records = sys.monitoring.get_coverage()
+        module_code = compile(source, "<coverage>", "exec")
+        self.assertEqual(self.covered_lines(module_code, records), [1, 2])
+        self.assertEqual(
+            self.covered_lines(class_code(module_code), records), [0, 1])
+
+    def test_merge(self):
+        # The coverage of code objects with the same identity is merged
+        source = textwrap.dedent("""
+            def f(x):
+                if x:
+                    return 1
+                return 2
+        """)
+        sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+        try:
+            for arg in (True, False):
+                ns = {}
+                exec(compile(source, "<merge>", "exec"), ns)
+                code = ns["f"].__code__
+                ns["f"](arg)
+                del ns
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+        records = [r for r in sys.monitoring.get_coverage()
+                   if r[:2] == ("<merge>", "f")]
+        self.assertEqual(len(records), 1)
+        self.assertEqual(self.covered_lines(code, records), [1, 2, 3])
+
+    def test_errors(self):
+        with self.assertRaises(ValueError):
+            sys.monitoring.start_coverage(TEST_TOOL, E.CALL)
+        with self.assertRaises(ValueError):
+            sys.monitoring.start_coverage(TEST_TOOL, 0)
+        with self.assertRaises(ValueError):
+            sys.monitoring.stop_coverage(TEST_TOOL)
+        sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+        try:
+            with self.assertRaises(ValueError):
+                sys.monitoring.start_coverage(TEST_TOOL2, E.LINE)
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+
+    def test_dump(self):
+        import marshal
+        from test.support import os_helper
+        sys.monitoring.start_coverage(TEST_TOOL, E.LINE)
+        try:
+            self.func(True)
+        finally:
+            sys.monitoring.stop_coverage(TEST_TOOL)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        sys.monitoring.dump_coverage(os_helper.TESTFN)
+        with open(os_helper.TESTFN, "rb") as fp:
+            dumped = marshal.load(fp)
+        self.assertEqual(dumped, sys.monitoring.get_coverage())
+
+    def test_dump_at_exit(self):
+        from test.support import os_helper, script_helper
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with os_helper.temp_dir() as tmp:
+            script_helper.make_script(tmp, "covmod", "def g():\n    return 2\n")
+            script = script_helper.make_script(tmp, "covmain", textwrap.dedent(f"""
+                import os, sys
+                E = sys.monitoring.events
+                sys.monitoring.use_tool_id(2, "coverage")
+                sys.monitoring.start_coverage(2, E.LINE, dump_path={os_helper.TESTFN!r})
+                sys.path.insert(0, os.path.dirname(__file__))
+                import covmod
+                class C:
+                    def f(self):
+                        return 1
+                C().f()
+            """))
+            script_helper.assert_python_ok(script)
+        import marshal
+        import os
+        with open(os_helper.TESTFN, "rb") as fp:
+            dumped = marshal.load(fp)
+        names = [(os.path.basename(filename), qualname)
+                 for filename, qualname, firstlineno, bitmap in dumped]
+        # Module and class bodies are dumped although their code objects
+        # were freed at exit
+        self.assertIn(("covmain.py", "<module>"), names)
+        self.assertIn(("covmain.py", "C"), names)
+        self.assertIn(("covmain.py", "C.f"), names)
+        self.assertIn(("covmod.py", "<module>"), names)
+
+    def test_dump_at_exit_latest_path(self):
+        import os
+        from test.support import os_helper, script_helper
+        old_path = os_helper.TESTFN + "_old"
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        self.addCleanup(os_helper.unlink, old_path)
+        code = textwrap.dedent(f"""
+            import sys
+            E = sys.monitoring.events
+            sys.monitoring.use_tool_id(2, "coverage")
+            for path in ({old_path!r}, {old_path!r}, {os_helper.TESTFN!r}):
+                sys.monitoring.start_coverage(2, E.LINE, dump_path=path)
+            import atexit
+            print(atexit._ncallbacks())
+        """)
+        res = script_helper.assert_python_ok("-c", code)
+        self.assertEqual(res.out.strip(), b"1")
+        self.assertFalse(os.path.exists(old_path))
+        self.assertTrue(os.path.exists(os_helper.TESTFN))
+
+
 class TestRegressions(MonitoringTestBase, unittest.TestCase):
 
     def test_105162(self):
@@ -1,4 +1,7 @@
+import dis
+import sys
 import unittest
+from test.support import requires_specialization
 
 
 class TestLoadSuperAttrCache(unittest.TestCase):
@@ -453,6 +456,11 @@ def f():
 
 
 class TestCallCache(unittest.TestCase):
+    def call_opnames(self, func):
+        return [instr.opname
+                for instr in dis.get_instructions(func, adaptive=True)
+                if instr.opname.startswith("CALL")]
+
     def test_too_many_defaults_0(self):
         def f():
             pass
@@ -480,6 +488,135 @@ def f(x, y):
             f(None)
             f()
 
+    @requires_specialization
+    def test_trivial_callee(self):
+        def const(x):
+            return 42
+
+        def arg(x, y):
+            return y
+
+        def nothing():
+            pass
+
+        def g():
+            return const(None), arg(None, "spam"), nothing()
+
+        for _ in range(1025):
+            self.assertEqual(g(), (42, "spam", None))
+        self.assertEqual(self.call_opnames(g), ["CALL_PY_TRIVIAL"] * 3)
+
+    @requires_specialization
+    def test_nontrivial_callee(self):
+        def defaults(x, y=None):
+            return y
+
+        def cell(x):
+            def inner():
+                return x
+            return x
+
+        def generator(x):
+            yield x
+
+        def call(x):
+            return len(x)
+
+        def g():
+            return (defaults(None), cell(1), generator(None), call(""))
+
+        for _ in range(1025):
+            g()
+        opnames = self.call_opnames(g)
+        self.assertEqual(len(opnames), 4)
+        self.assertNotIn("CALL_PY_TRIVIAL", opnames)
+        self.assertEqual(opnames[0], "CALL_PY_WITH_DEFAULTS")
+        self.assertEqual(opnames[1], "CALL_PY_EXACT_ARGS")
+        self.assertEqual(opnames[3], "CALL_PY_EXACT_ARGS")
+
+    @requires_specialization
+    def test_trivial_callee_code_replaced(self):
+        def f(x):
+            return x
+
+        def g(x):
+            return f(x)
+
+        for _ in range(1025):
+            self.assertEqual(g(1), 1)
+        self.assertEqual(self.call_opnames(g), ["CALL_PY_TRIVIAL"])
+        f.__code__ = (lambda x: x + 1).__code__
+        for _ in range(1025):
+            self.assertEqual(g(1), 2)
+        self.assertEqual(self.call_opnames(g), ["CALL_PY_EXACT_ARGS"])
+
+    def test_trivial_callee_refcount(self):
+        def f(x, y):
+            return x
+
+        def g(x, y):
+            return f(x, y)
+
+        x = object()
+        y = object()
+        rc_x = sys.getrefcount(x)
+        rc_y = sys.getrefcount(y)
+        for _ in range(1025):
+            self.assertIs(g(x, y), x)
+        self.assertEqual(sys.getrefcount(x), rc_x)
+        self.assertEqual(sys.getrefcount(y), rc_y)
+
+    def test_trivial_callee_monitoring(self):
+        def f():
+            return None
+
+        def g():
+            f()
+
+        for _ in range(1025):
+            g()
+        starts = []
+
+        def callback(code, offset):
+            starts.append(code)
+
+        tool = sys.monitoring.PROFILER_ID
+        sys.monitoring.use_tool_id(tool, "test_opcache")
+        try:
+            sys.monitoring.register_callback(
+                tool, sys.monitoring.events.PY_START, callback)
+            sys.monitoring.set_events(tool, sys.monitoring.events.PY_START)
+            g()
+        finally:
+            sys.monitoring.set_events(tool, 0)
+            sys.monitoring.register_callback(
+                tool, sys.monitoring.events.PY_START, None)
+            sys.monitoring.free_tool_id(tool)
+        self.assertEqual(starts, [g.__code__, f.__code__])
+
+    def test_trivial_callee_trace(self):
+        def f():
+            return None
+
+        def g():
+            f()
+
+        for _ in range(1025):
+            g()
+        calls = []
+
+        def tracer(frame, event, arg):
+            if event == "call":
+                calls.append(frame.f_code)
+            return tracer
+
+        sys.settrace(tracer)
+        try:
+            g()
+        finally:
+            sys.settrace(None)
+        self.assertEqual(calls, [g.__code__, f.__code__])
+
 
 if __name__ == "__main__":
     import unittest
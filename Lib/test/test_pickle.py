@@ -35,6 +35,7 @@
 class PyPickleTests(AbstractPickleModuleTests, unittest.TestCase):
     dump = staticmethod(pickle._dump)
     dumps = staticmethod(pickle._dumps)
+    dumps_chunks = staticmethod(pickle._dumps_chunks)
     load = staticmethod(pickle._load)
     loads = staticmethod(pickle._loads)
     Pickler = pickle._Pickler
@@ -239,6 +240,7 @@ class CustomPyPicklerClass(pickle._Pickler,
 if has_c_implementation:
     class CPickleTests(AbstractPickleModuleTests, unittest.TestCase):
         from _pickle import dump, dumps, load, loads, Pickler, Unpickler
+        dumps_chunks = staticmethod(pickle.dumps_chunks)
 
     class CUnpicklerTests(PyUnpicklerTests):
         unpickler = _pickle.Unpickler
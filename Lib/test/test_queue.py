@@ -6,6 +6,7 @@
 import time
 import unittest
 import weakref
+from test import support
 from test.support import gc_collect
 from test.support import import_helper
 from test.support import threading_helper
@@ -542,6 +543,72 @@ def test_negative_timeout_raises_exception(self):
         with self.assertRaises(ValueError):
             q.get(timeout=-1)
 
+    def test_put_many_get_many(self):
+        q = self.q
+        q.put_many([])
+        self.assertTrue(q.empty())
+        q.put(0)
+        q.put_many(range(1, 6))
+        q.put_many(iter([6, 7]))
+        self.assertEqual(q.qsize(), 8)
+        self.assertEqual(q.get_many(3), [0, 1, 2])
+        self.assertEqual(q.get(), 3)
+        self.assertEqual(q.get_many(10, block=False), [4, 5, 6, 7])
+        self.assertTrue(q.empty())
+
+        with self.assertRaises(self.queue.Empty):
+            q.get_many(1, block=False)
+        with self.assertRaises(self.queue.Empty):
+            q.get_many(1, timeout=1e-3)
+        with self.assertRaises(ValueError):
+            q.get_many(0)
+        with self.assertRaises(TypeError):
+            q.put_many(1)
+        self.assertTrue(q.empty())
+
+        # The storage is compacted while items are taken out in batches.
+        q.put_many(range(100))
+        results = []
+        for i in range(100, 200):
+            results += q.get_many(3, block=False)
+            q.put(i)
+        results += q.get_many(1000, block=False)
+        self.assertEqual(results, list(range(200)))
+
+    def test_put_many_failing_iterable(self):
+        q = self.q
+        q.put(0)
+        def items():
+            yield 1
+            yield 2
+            raise ZeroDivisionError
+        with self.assertRaises(ZeroDivisionError):
+            q.put_many(items())
+        # No item was added
+        self.assertEqual(q.qsize(), 1)
+        self.assertEqual(q.get_many(10, block=False), [0])
+        with self.assertRaises(self.queue.Empty):
+            q.get(block=False)
+
+        # A getter waiting on the queue still gets the next items
+        def feed():
+            time.sleep(0.05)
+            with self.assertRaises(ZeroDivisionError):
+                q.put_many(items())
+            q.put_many([3, 4])
+        with threading_helper.start_threads([threading.Thread(target=feed)]):
+            result = q.get_many(5, timeout=support.LONG_TIMEOUT)
+        self.assertEqual(result, [3, 4])
+
+    def test_get_many_blocking(self):
+        q = self.q
+        def feed():
+            time.sleep(0.05)
+            q.put_many([1, 2, 3])
+        with threading_helper.start_threads([threading.Thread(target=feed)]):
+            items = q.get_many(5, timeout=support.LONG_TIMEOUT)
+        self.assertEqual(items, [1, 2, 3])
+
     def test_order(self):
         # Test a pair of concurrent put() and get()
         q = self.q
@@ -2749,6 +2749,44 @@ def testRecvFromNegative(self):
     def _testRecvFromNegative(self):
         self.cli.sendto(MSG, 0, (HOST, self.port))
 
+    @requireAttrs(socket.socket, 'recvmmsg_into')
+    def testRecvmmsgInto(self):
+        # Testing recvmmsg_into() over UDP
+        self.serv.settimeout(support.LONG_TIMEOUT)
+        buf = bytearray(1024)
+        received = []
+        # Each call returns at least one datagram
+        for _ in range(3):
+            if len(received) >= 3:
+                break
+            for offset, nbytes, addr in self.serv.recvmmsg_into(buf, 256):
+                self.assertEqual(offset % 256, 0)
+                self.assertEqual(len(addr), 2)
+                received.append(bytes(buf[offset:offset + nbytes]))
+        self.assertEqual(received, [MSG, MSG * 2, MSG * 3])
+
+    @requireAttrs(socket.socket, 'sendmmsg')
+    def _testRecvmmsgInto(self):
+        messages = [(MSG, (HOST, self.port)),
+                    (bytearray(MSG * 2), (HOST, self.port)),
+                    (memoryview(MSG * 3), (HOST, self.port))]
+        self.assertEqual(self.cli.sendmmsg(messages), 3)
+
+    @requireAttrs(socket.socket, 'recvmmsg_into')
+    def testRecvmmsgIntoErrors(self):
+        self.assertRaises(ValueError, self.serv.recvmmsg_into,
+                          bytearray(16), 0)
+        self.assertRaises(ValueError, self.serv.recvmmsg_into,
+                          bytearray(16), 17)
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, b'x' * 16, 16)
+
+    @requireAttrs(socket.socket, 'sendmmsg')
+    def _testRecvmmsgIntoErrors(self):
+        self.assertEqual(self.cli.sendmmsg([]), 0)
+        self.assertRaises(TypeError, self.cli.sendmmsg, [MSG])
+        self.assertRaises(TypeError, self.cli.sendmmsg, [('data', None)])
+        self.assertRaises(TypeError, self.cli.sendmmsg, 42)
+
 
 @unittest.skipUnless(HAVE_SOCKET_UDPLITE,
           'UDPLITE sockets required for this test.')
@@ -947,5 +947,64 @@ def test_half_float(self):
             self.assertEqual(bits, struct.pack(formatcode, f))
 
 
+class UnpackIntoColumnsTest(unittest.TestCase):
+    """
+    Tests for columnar unpacking (struct.Struct.unpack_into_columns).
+    """
+
+    def check_columns(self, fmt, records):
+        s = struct.Struct(fmt)
+        buffer = b''.join(s.pack(*record) for record in records)
+        columns = s.unpack_into_columns(buffer)
+        self.assertIsInstance(columns, tuple)
+        self.assertEqual(len(columns), len(s.unpack_from(bytes(s.size))))
+        for column, expected in zip(columns, zip(*s.iter_unpack(buffer))):
+            self.assertIsInstance(column, array.array)
+            self.assertEqual(column.tolist(), list(expected))
+
+    def test_integers(self):
+        for code, byteorder in iter_integer_formats():
+            with self.subTest(code=code, byteorder=byteorder):
+                fmt = byteorder + 'b' + code + '2' + code
+                size = struct.calcsize(byteorder + code)
+                if code.islower():
+                    lo, hi = -2 ** (8 * size - 1), 2 ** (8 * size - 1) - 1
+                else:
+                    lo, hi = 0, 2 ** (8 * size) - 1
+                records = [(-i, lo + i, hi - i, i) for i in range(10)]
+                self.check_columns(fmt, records)
+
+    def test_floats(self):
+        for byteorder in byteorders:
+            with self.subTest(byteorder=byteorder):
+                records = [(i / 3, i, -i / 7) for i in range(20)]
+                self.check_columns(byteorder + 'fHd', records)
+
+    def test_pointers_and_padding(self):
+        self.check_columns('P3xq', [(i, -i) for i in range(10)])
+
+    def test_empty(self):
+        columns = struct.Struct('<id').unpack_into_columns(b'')
+        self.assertEqual([c.tolist() for c in columns], [[], []])
+
+    def test_arbitrary_buffer(self):
+        s = struct.Struct('>IB')
+        columns = s.unpack_into_columns(memoryview(bytes(range(1, 11))))
+        self.assertEqual(columns[0].tolist(), [0x01020304, 0x06070809])
+        self.assertEqual(columns[1].tolist(), [5, 10])
+
+    def test_errors(self):
+        s = struct.Struct('>IB')
+        with self.assertRaises(struct.error):
+            s.unpack_into_columns(b'123456')
+        with self.assertRaises(TypeError):
+            s.unpack_into_columns('12345')
+        with self.assertRaises(struct.error):
+            struct.Struct('>').unpack_into_columns(b'')
+        for code in '?cspe':
+            with self.assertRaises(struct.error):
+                struct.Struct('i' + code).unpack_into_columns(b'')
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -46,6 +46,11 @@ typedef struct {
 
     /* Imports from asyncio.events. */
     PyObject *asyncio_get_event_loop_policy;
+    PyObject *asyncio_Handle;
+    PyObject *asyncio_TimerHandle;
+    /* Handle._run at import time: run_handle() only bypasses it while
+       it is not replaced. */
+    PyObject *asyncio_Handle_run;
 
     /* Imports from asyncio.base_futures. */
     PyObject *asyncio_future_repr_func;
@@ -2136,12 +2141,23 @@ _asyncio_Task___init___impl(TaskObj *self, PyObject *coro, PyObject *loop,
     }
 
     if (eager_start) {
-        PyObject *res = PyObject_CallMethodNoArgs(loop, &_Py_ID(is_running));
-        if (res == NULL) {
+        /* Tasks are usually created from a coroutine running in the loop,
+           so check the running loop first to avoid calling is_running(). */
+        PyObject *running_loop;
+        if (get_running_loop(state, &running_loop) < 0) {
             return -1;
         }
-        int is_loop_running = Py_IsTrue(res);
-        Py_DECREF(res);
+        int is_loop_running = (running_loop == self->task_loop);
+        Py_XDECREF(running_loop);
+        if (!is_loop_running) {
+            PyObject *res = PyObject_CallMethodNoArgs(self->task_loop,
+                                                      &_Py_ID(is_running));
+            if (res == NULL) {
+                return -1;
+            }
+            is_loop_running = Py_IsTrue(res);
+            Py_DECREF(res);
+        }
         if (is_loop_running) {
             if (task_eager_start(state, self)) {
                 return -1;
@@ -3501,6 +3517,432 @@ _asyncio__swap_current_task_impl(PyObject *module, PyObject *loop,
 }
 
 
+/* Run a handle from the ready queue, as Handle._run() does.
+   The callback of a plain Handle or TimerHandle is called directly in the
+   handle's context, without going through _run() and Context.run(). */
+static int
+run_handle(asyncio_state *state, PyObject *handle)
+{
+    PyObject *cancelled = PyObject_GetAttr(handle, &_Py_ID(_cancelled));
+    if (cancelled == NULL) {
+        return -1;
+    }
+    int is_cancelled = PyObject_IsTrue(cancelled);
+    Py_DECREF(cancelled);
+    if (is_cancelled) {
+        return is_cancelled < 0 ? -1 : 0;
+    }
+
+    PyObject *res;
+    if (Py_TYPE(handle) != (PyTypeObject *)state->asyncio_Handle &&
+        Py_TYPE(handle) != (PyTypeObject *)state->asyncio_TimerHandle)
+    {
+        goto slow_path;
+    }
+    if (_PyType_Lookup(Py_TYPE(handle), &_Py_ID(_run)) !=
+        state->asyncio_Handle_run)
+    {
+        goto slow_path;
+    }
+
+    PyObject *context = PyObject_GetAttr(handle, &_Py_ID(_context));
+    if (context == NULL) {
+        return -1;
+    }
+    if (!PyContext_CheckExact(context)) {
+        Py_DECREF(context);
+        goto slow_path;
+    }
+    PyObject *args = PyObject_GetAttr(handle, &_Py_ID(_args));
+    if (args == NULL) {
+        Py_DECREF(context);
+        return -1;
+    }
+    if (!PyTuple_CheckExact(args)) {
+        Py_DECREF(context);
+        Py_DECREF(args);
+        goto slow_path;
+    }
+    PyObject *callback = PyObject_GetAttr(handle, &_Py_ID(_callback));
+    if (callback == NULL) {
+        Py_DECREF(context);
+        Py_DECREF(args);
+        return -1;
+    }
+
+    res = NULL;
+    if (PyContext_Enter(context) == 0) {
+        res = PyObject_Call(callback, args, NULL);
+        if (PyContext_Exit(context) < 0) {
+            Py_CLEAR(res);
+        }
+    }
+    Py_DECREF(context);
+    Py_DECREF(args);
+    Py_DECREF(callback);
+    if (res != NULL) {
+        Py_DECREF(res);
+        return 0;
+    }
+    if (PyErr_ExceptionMatches(PyExc_SystemExit) ||
+        PyErr_ExceptionMatches(PyExc_KeyboardInterrupt))
+    {
+        return -1;
+    }
+    PyObject *exc = PyErr_GetRaisedException();
+    res = PyObject_CallMethodOneArg(handle, &_Py_ID(_call_exception_handler),
+                                    exc);
+    Py_DECREF(exc);
+    goto done;
+
+slow_path:
+    res = PyObject_CallMethodNoArgs(handle, &_Py_ID(_run));
+done:
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
+}
+
+
+/*[clinic input]
+_asyncio._run_ready
+
+    ready: object
+    ntodo: Py_ssize_t
+    /
+
+Run the first ntodo handles of the ready queue of an event loop.
+
+Cancelled handles are skipped.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__run_ready_impl(PyObject *module, PyObject *ready, Py_ssize_t ntodo)
+/*[clinic end generated code: output=07b364c488de9d1f input=4a8fb02680d1c5e3]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    PyObject *popleft = PyObject_GetAttr(ready, &_Py_ID(popleft));
+    if (popleft == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < ntodo; i++) {
+        PyObject *handle = PyObject_CallNoArgs(popleft);
+        if (handle == NULL) {
+            Py_DECREF(popleft);
+            return NULL;
+        }
+        int res = run_handle(state, handle);
+        Py_DECREF(handle);
+        if (res < 0) {
+            Py_DECREF(popleft);
+            return NULL;
+        }
+    }
+    Py_DECREF(popleft);
+    Py_RETURN_NONE;
+}
+
+
+/* Return 1 if a sorts before b in the timer heap, 0 if not, or -1 on
+   error.  For exact TimerHandle objects this compares their _when
+   attributes directly, as TimerHandle.__lt__() does, without calling it. */
+static int
+timer_lt(asyncio_state *state, PyObject *a, PyObject *b)
+{
+    if (!Py_IS_TYPE(a, (PyTypeObject *)state->asyncio_TimerHandle) ||
+        !Py_IS_TYPE(b, (PyTypeObject *)state->asyncio_TimerHandle))
+    {
+        return PyObject_RichCompareBool(a, b, Py_LT);
+    }
+    PyObject *when_a = PyObject_GetAttr(a, &_Py_ID(_when));
+    if (when_a == NULL) {
+        return -1;
+    }
+    PyObject *when_b = PyObject_GetAttr(b, &_Py_ID(_when));
+    if (when_b == NULL) {
+        Py_DECREF(when_a);
+        return -1;
+    }
+    int res;
+    if (PyFloat_CheckExact(when_a) && PyFloat_CheckExact(when_b)) {
+        res = PyFloat_AS_DOUBLE(when_a) < PyFloat_AS_DOUBLE(when_b);
+    }
+    else {
+        res = PyObject_RichCompareBool(when_a, when_b, Py_LT);
+    }
+    Py_DECREF(when_a);
+    Py_DECREF(when_b);
+    return res;
+}
+
+/* heapq's siftdown() and siftup(), using timer_lt() */
+static int
+timer_heap_siftdown(asyncio_state *state, PyListObject *heap,
+                    Py_ssize_t startpos, Py_ssize_t pos)
+{
+    Py_ssize_t size = PyList_GET_SIZE(heap);
+    while (pos > startpos) {
+        Py_ssize_t parentpos = (pos - 1) >> 1;
+        PyObject *newitem = Py_NewRef(heap->ob_item[pos]);
+        PyObject *parent = Py_NewRef(heap->ob_item[parentpos]);
+        int cmp = timer_lt(state, newitem, parent);
+        Py_DECREF(parent);
+        Py_DECREF(newitem);
+        if (cmp < 0) {
+            return -1;
+        }
+        if (size != PyList_GET_SIZE(heap)) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "list changed size during iteration");
+            return -1;
+        }
+        if (cmp == 0) {
+            break;
+        }
+        parent = heap->ob_item[parentpos];
+        heap->ob_item[parentpos] = heap->ob_item[pos];
+        heap->ob_item[pos] = parent;
+        pos = parentpos;
+    }
+    return 0;
+}
+
+static int
+timer_heap_siftup(asyncio_state *state, PyListObject *heap, Py_ssize_t pos)
+{
+    Py_ssize_t endpos = PyList_GET_SIZE(heap);
+    Py_ssize_t startpos = pos;
+    Py_ssize_t limit = endpos >> 1;
+    while (pos < limit) {
+        Py_ssize_t childpos = 2 * pos + 1;
+        if (childpos + 1 < endpos) {
+            PyObject *a = Py_NewRef(heap->ob_item[childpos]);
+            PyObject *b = Py_NewRef(heap->ob_item[childpos + 1]);
+            int cmp = timer_lt(state, a, b);
+            Py_DECREF(a);
+            Py_DECREF(b);
+            if (cmp < 0) {
+                return -1;
+            }
+            childpos += ((unsigned)cmp ^ 1);
+            if (endpos != PyList_GET_SIZE(heap)) {
+                PyErr_SetString(PyExc_RuntimeError,
+                                "list changed size during iteration");
+                return -1;
+            }
+        }
+        PyObject *tmp = heap->ob_item[childpos];
+        heap->ob_item[childpos] = heap->ob_item[pos];
+        heap->ob_item[pos] = tmp;
+        pos = childpos;
+    }
+    return timer_heap_siftdown(state, heap, startpos, pos);
+}
+
+/* Pop the first handle of the timer heap, as heapq.heappop() does. */
+static PyObject *
+timer_heap_pop(asyncio_state *state, PyObject *heap)
+{
+    Py_ssize_t n = PyList_GET_SIZE(heap);
+    assert(n > 0);
+    PyObject *last = Py_NewRef(PyList_GET_ITEM(heap, n - 1));
+    if (PyList_SetSlice(heap, n - 1, n, NULL) < 0) {
+        Py_DECREF(last);
+        return NULL;
+    }
+    if (n == 1) {
+        return last;
+    }
+    PyObject *first = PyList_GET_ITEM(heap, 0);
+    PyList_SET_ITEM(heap, 0, last);
+    if (timer_heap_siftup(state, (PyListObject *)heap, 0) < 0) {
+        Py_DECREF(first);
+        return NULL;
+    }
+    return first;
+}
+
+/*[clinic input]
+_asyncio._pop_due_timers
+
+    scheduled: object(subclass_of='&PyList_Type')
+    ready: object
+    end_time: object
+    /
+
+Move the timer handles due before end_time to the ready queue.
+
+The handles are popped from the scheduled heap in order.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__pop_due_timers_impl(PyObject *module, PyObject *scheduled,
+                              PyObject *ready, PyObject *end_time)
+/*[clinic end generated code: output=7b8c213cfae5f993 input=5295d070330fcced]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    PyObject *append = PyObject_GetAttr(ready, &_Py_ID(append));
+    if (append == NULL) {
+        return NULL;
+    }
+    while (PyList_GET_SIZE(scheduled) > 0) {
+        PyObject *handle = Py_NewRef(PyList_GET_ITEM(scheduled, 0));
+        PyObject *when = PyObject_GetAttr(handle, &_Py_ID(_when));
+        Py_DECREF(handle);
+        if (when == NULL) {
+            goto error;
+        }
+        int due;
+        if (PyFloat_CheckExact(when) && PyFloat_CheckExact(end_time)) {
+            due = !(PyFloat_AS_DOUBLE(when) >= PyFloat_AS_DOUBLE(end_time));
+        }
+        else {
+            due = PyObject_RichCompareBool(when, end_time, Py_GE);
+            due = due < 0 ? -1 : !due;
+        }
+        Py_DECREF(when);
+        if (due <= 0) {
+            if (due < 0) {
+                goto error;
+            }
+            break;
+        }
+        if (PyList_GET_SIZE(scheduled) == 0) {
+            break;
+        }
+        handle = timer_heap_pop(state, scheduled);
+        if (handle == NULL) {
+            goto error;
+        }
+        if (PyObject_SetAttr(handle, &_Py_ID(_scheduled), Py_False) < 0) {
+            Py_DECREF(handle);
+            goto error;
+        }
+        PyObject *res = PyObject_CallOneArg(append, handle);
+        Py_DECREF(handle);
+        if (res == NULL) {
+            goto error;
+        }
+        Py_DECREF(res);
+    }
+    Py_DECREF(append);
+    Py_RETURN_NONE;
+
+error:
+    Py_DECREF(append);
+    return NULL;
+}
+
+/*[clinic input]
+_asyncio._process_selector_events
+
+    loop: object
+    ready: object
+    event_list: object
+    /
+
+Add the handles for the (key, mask) pairs of event_list to the ready queue.
+
+This is what BaseSelectorEventLoop._process_events() does, for loops
+whose _add_callback() method is not overridden.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__process_selector_events_impl(PyObject *module, PyObject *loop,
+                                       PyObject *ready, PyObject *event_list)
+/*[clinic end generated code: output=dea702160eb40719 input=831bea4490c8465b]*/
+{
+    /* selectors.EVENT_READ and selectors.EVENT_WRITE */
+    static const long event_masks[2] = {1, 2};
+    PyObject *const remove_names[2] = {
+        &_Py_ID(_remove_reader), &_Py_ID(_remove_writer)
+    };
+
+    PyObject *events = PySequence_Fast(event_list, "event_list must be iterable");
+    if (events == NULL) {
+        return NULL;
+    }
+    PyObject *append = PyObject_GetAttr(ready, &_Py_ID(append));
+    if (append == NULL) {
+        Py_DECREF(events);
+        return NULL;
+    }
+    PyObject *key = NULL, *fileobj = NULL, *data = NULL, *handles = NULL;
+    for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(events); i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(events, i);
+        if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 2) {
+            PyErr_SetString(PyExc_TypeError,
+                            "event_list items must be (key, mask) pairs");
+            goto error;
+        }
+        key = Py_NewRef(PyTuple_GET_ITEM(item, 0));
+        long mask = PyLong_AsLong(PyTuple_GET_ITEM(item, 1));
+        if (mask == -1 && PyErr_Occurred()) {
+            goto error;
+        }
+        fileobj = PyObject_GetAttr(key, &_Py_ID(fileobj));
+        if (fileobj == NULL) {
+            goto error;
+        }
+        data = PyObject_GetAttr(key, &_Py_ID(data));
+        if (data == NULL) {
+            goto error;
+        }
+        handles = PySequence_Fast(data, "key data must be iterable");
+        if (handles == NULL) {
+            goto error;
+        }
+        if (PySequence_Fast_GET_SIZE(handles) != 2) {
+            PyErr_SetString(PyExc_ValueError,
+                            "key data must be a (reader, writer) pair");
+            goto error;
+        }
+        for (int j = 0; j < 2; j++) {
+            PyObject *handle = PySequence_Fast_GET_ITEM(handles, j);
+            if (!(mask & event_masks[j]) || handle == Py_None) {
+                continue;
+            }
+            Py_INCREF(handle);
+            PyObject *cancelled = PyObject_GetAttr(handle, &_Py_ID(_cancelled));
+            int is_cancelled = cancelled == NULL ? -1 : PyObject_IsTrue(cancelled);
+            Py_XDECREF(cancelled);
+            PyObject *res;
+            if (is_cancelled < 0) {
+                res = NULL;
+            }
+            else if (is_cancelled) {
+                res = PyObject_CallMethodOneArg(loop, remove_names[j], fileobj);
+            }
+            else {
+                res = PyObject_CallOneArg(append, handle);
+            }
+            Py_DECREF(handle);
+            if (res == NULL) {
+                goto error;
+            }
+            Py_DECREF(res);
+        }
+        Py_CLEAR(handles);
+        Py_CLEAR(data);
+        Py_CLEAR(fileobj);
+        Py_CLEAR(key);
+    }
+    Py_DECREF(append);
+    Py_DECREF(events);
+    Py_RETURN_NONE;
+
+error:
+    Py_XDECREF(handles);
+    Py_XDECREF(data);
+    Py_XDECREF(fileobj);
+    Py_XDECREF(key);
+    Py_DECREF(append);
+    Py_DECREF(events);
+    return NULL;
+}
+
 /*[clinic input]
 _asyncio.current_task
 
@@ -3575,6 +4017,9 @@ module_traverse(PyObject *mod, visitproc visit, void *arg)
     Py_VISIT(state->traceback_extract_stack);
     Py_VISIT(state->asyncio_future_repr_func);
     Py_VISIT(state->asyncio_get_event_loop_policy);
+    Py_VISIT(state->asyncio_Handle);
+    Py_VISIT(state->asyncio_TimerHandle);
+    Py_VISIT(state->asyncio_Handle_run);
     Py_VISIT(state->asyncio_iscoroutine_func);
     Py_VISIT(state->asyncio_task_get_stack_func);
     Py_VISIT(state->asyncio_task_print_stack_func);
@@ -3613,6 +4058,9 @@ module_clear(PyObject *mod)
     Py_CLEAR(state->traceback_extract_stack);
     Py_CLEAR(state->asyncio_future_repr_func);
     Py_CLEAR(state->asyncio_get_event_loop_policy);
+    Py_CLEAR(state->asyncio_Handle);
+    Py_CLEAR(state->asyncio_TimerHandle);
+    Py_CLEAR(state->asyncio_Handle_run);
     Py_CLEAR(state->asyncio_iscoroutine_func);
     Py_CLEAR(state->asyncio_task_get_stack_func);
     Py_CLEAR(state->asyncio_task_print_stack_func);
@@ -3679,6 +4127,13 @@ module_init(asyncio_state *state)
 
     WITH_MOD("asyncio.events")
     GET_MOD_ATTR(state->asyncio_get_event_loop_policy, "get_event_loop_policy")
+    GET_MOD_ATTR(state->asyncio_Handle, "Handle")
+    GET_MOD_ATTR(state->asyncio_TimerHandle, "TimerHandle")
+    state->asyncio_Handle_run = PyObject_GetAttr(state->asyncio_Handle,
+                                                 &_Py_ID(_run));
+    if (state->asyncio_Handle_run == NULL) {
+        goto fail;
+    }
 
     WITH_MOD("asyncio.base_futures")
     GET_MOD_ATTR(state->asyncio_future_repr_func, "_future_repr")
@@ -3738,6 +4193,9 @@ static PyMethodDef asyncio_methods[] = {
     _ASYNCIO__ENTER_TASK_METHODDEF
     _ASYNCIO__LEAVE_TASK_METHODDEF
     _ASYNCIO__SWAP_CURRENT_TASK_METHODDEF
+    _ASYNCIO__RUN_READY_METHODDEF
+    _ASYNCIO__POP_DUE_TIMERS_METHODDEF
+    _ASYNCIO__PROCESS_SELECTOR_EVENTS_METHODDEF
     {NULL, NULL}
 };
 
@@ -608,16 +608,13 @@ _call_dialect(_csvstate *module_state, PyObject *dialect_inst, PyObject *kwargs)
 /*
  * READER
  */
+/* Append a parsed field to the current record.  Steals a reference to
+   field, which may be NULL if creating it failed. */
 static int
-parse_save_field(ReaderObj *self)
+parse_save_field_object(ReaderObj *self, PyObject *field)
 {
-    PyObject *field;
-
-    field = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
-                                      (void *) self->field, self->field_len);
     if (field == NULL)
         return -1;
-    self->field_len = 0;
     if (self->numeric_field) {
         PyObject *tmp;
 
@@ -636,6 +633,17 @@ parse_save_field(ReaderObj *self)
     return 0;
 }
 
+static int
+parse_save_field(ReaderObj *self)
+{
+    PyObject *field;
+
+    field = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
+                                      (void *) self->field, self->field_len);
+    self->field_len = 0;
+    return parse_save_field_object(self, field);
+}
+
 static int
 parse_grow_buff(ReaderObj *self)
 {
@@ -653,21 +661,41 @@ parse_grow_buff(ReaderObj *self)
     return 1;
 }
 
+static int
+parse_field_limit_error(_csvstate *module_state)
+{
+    PyErr_Format(module_state->error_obj,
+                 "field larger than field limit (%ld)",
+                 module_state->field_limit);
+    return -1;
+}
+
 static int
 parse_add_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 {
-    if (self->field_len >= module_state->field_limit) {
-        PyErr_Format(module_state->error_obj,
-                     "field larger than field limit (%ld)",
-                     module_state->field_limit);
-        return -1;
-    }
+    if (self->field_len >= module_state->field_limit)
+        return parse_field_limit_error(module_state);
     if (self->field_len == self->field_size && !parse_grow_buff(self))
         return -1;
     self->field[self->field_len++] = c;
     return 0;
 }
 
+static int
+parse_add_chars(ReaderObj *self, _csvstate *module_state,
+                const Py_UCS1 *chars, Py_ssize_t n)
+{
+    if (n > module_state->field_limit - self->field_len)
+        return parse_field_limit_error(module_state);
+    while (self->field_size - self->field_len < n) {
+        if (!parse_grow_buff(self))
+            return -1;
+    }
+    for (Py_ssize_t i = 0; i < n; i++)
+        self->field[self->field_len++] = chars[i];
+    return 0;
+}
+
 static int
 parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 {
@@ -851,6 +879,86 @@ parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
     return 0;
 }
 
+/* Fast path for one-byte lines: consume, starting at pos, a run of
+   characters that parse_process_char() would all treat the same way.
+   An unquoted field that ends on this line is sliced directly out of it
+   instead of being copied through the field buffer.
+
+   Returns the position after the run (pos itself if the character at pos
+   needs the generic state machine), or -1 on error. */
+static Py_ssize_t
+parse_process_run(ReaderObj *self, _csvstate *module_state,
+                  PyObject *lineobj, Py_ssize_t pos)
+{
+    DialectObj *dialect = self->dialect;
+    const Py_UCS1 *data = PyUnicode_1BYTE_DATA(lineobj);
+    Py_ssize_t len = PyUnicode_GET_LENGTH(lineobj);
+    Py_UCS4 delimiter = dialect->delimiter;
+    Py_UCS4 escapechar = dialect->escapechar;
+    Py_UCS4 quotechar = (dialect->quoting != QUOTE_NONE ?
+                         dialect->quotechar : NOT_SET);
+    Py_ssize_t end = pos;
+    Py_UCS4 c = data[pos];
+
+#define IS_FIELD_END(c) \
+    ((c) == delimiter || (c) == '\n' || (c) == '\r' || (c) == escapechar)
+
+    switch (self->state) {
+    case START_RECORD:
+        if (c == '\n' || c == '\r')
+            return pos;
+        self->state = START_FIELD;
+        /* fallthru */
+    case START_FIELD:
+        if (IS_FIELD_END(c) || c == quotechar ||
+            (c == ' ' && dialect->skipinitialspace))
+        {
+            return pos;
+        }
+        if (dialect->quoting == QUOTE_NONNUMERIC)
+            self->numeric_field = 1;
+        while (end < len && !IS_FIELD_END(data[end]))
+            end++;
+        if (end < len && data[end] == escapechar) {
+            /* Leave the escape to the state machine */
+            self->state = IN_FIELD;
+            if (parse_add_chars(self, module_state, data + pos, end - pos) < 0)
+                return -1;
+            return end;
+        }
+        if (end - pos > module_state->field_limit)
+            return parse_field_limit_error(module_state);
+        if (parse_save_field_object(self,
+                                    PyUnicode_Substring(lineobj, pos, end)) < 0)
+            return -1;
+        if (end == len) {
+            /* The EOL that follows ends the record */
+            self->state = START_RECORD;
+            return end;
+        }
+        self->state = (data[end] == delimiter ? START_FIELD : EAT_CRNL);
+        return end + 1;
+
+    case IN_FIELD:
+        while (end < len && !IS_FIELD_END(data[end]))
+            end++;
+        break;
+
+    case IN_QUOTED_FIELD:
+        while (end < len && data[end] != quotechar && data[end] != escapechar)
+            end++;
+        break;
+
+    default:
+        return pos;
+    }
+#undef IS_FIELD_END
+
+    if (parse_add_chars(self, module_state, data + pos, end - pos) < 0)
+        return -1;
+    return end;
+}
+
 static int
 parse_reset(ReaderObj *self)
 {
@@ -914,7 +1022,19 @@ Reader_iternext(ReaderObj *self)
         data = PyUnicode_DATA(lineobj);
         pos = 0;
         linelen = PyUnicode_GET_LENGTH(lineobj);
-        while (linelen--) {
+        while (pos < linelen) {
+            if (kind == PyUnicode_1BYTE_KIND) {
+                Py_ssize_t next = parse_process_run(self, module_state,
+                                                    lineobj, pos);
+                if (next < 0) {
+                    Py_DECREF(lineobj);
+                    goto err;
+                }
+                if (next > pos) {
+                    pos = next;
+                    continue;
+                }
+            }
             c = PyUnicode_READ(kind, data, pos);
             if (parse_process_char(self, module_state, c) < 0) {
                 Py_DECREF(lineobj);
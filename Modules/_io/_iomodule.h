@@ -136,6 +136,11 @@ typedef off_t Py_off_t;
 
 extern Py_off_t PyNumber_AsOff_t(PyObject *item, PyObject *err);
 
+/* Asks the OS to start reading `len` bytes at `offset` of the given FileIO
+   object in the background.  Doesn't check the argument type either. */
+extern void _PyFileIO_readahead(PyObject *self, Py_off_t offset,
+                                Py_ssize_t len);
+
 /* Implementation details */
 
 /* IO module structure */
@@ -230,6 +230,9 @@ typedef struct {
 
     /* Absolute position inside the raw stream (-1 if unknown). */
     Py_off_t abs_pos;
+    /* Absolute position just after the previous raw read (-1 if unknown).
+       A raw read starting there is part of a sequential scan. */
+    Py_off_t readahead_pos;
 
     /* A static buffer of size `buffer_size` */
     char *buffer;
@@ -821,6 +824,7 @@ _buffered_init(buffered *self)
         self->buffer_mask = self->buffer_size - 1;
     else
         self->buffer_mask = 0;
+    self->readahead_pos = -1;
     if (_buffered_raw_tell(self) == -1)
         PyErr_Clear();
     return 0;
@@ -1538,12 +1542,19 @@ _io_BufferedReader___init___impl(buffered *self, PyObject *raw,
     return 0;
 }
 
+/* Sequential raw reads of at least this size ask the OS to prefetch the
+   next chunk of a FileIO stream, so that the disk I/O overlaps with the
+   processing of the current chunk.  Smaller reads are already covered by
+   the kernel's own readahead window. */
+#define READAHEAD_MIN_SIZE (128 * 1024)
+
 static Py_ssize_t
 _bufferedreader_raw_read(buffered *self, char *start, Py_ssize_t len)
 {
     Py_buffer buf;
     PyObject *memobj, *res;
     Py_ssize_t n;
+    Py_off_t start_pos = self->abs_pos;
     /* NOTE: the buffer needn't be released as its object is NULL. */
     if (PyBuffer_FillInfo(&buf, NULL, start, len, 0, PyBUF_CONTIG) == -1)
         return -1;
@@ -1585,6 +1596,11 @@ _bufferedreader_raw_read(buffered *self, char *start, Py_ssize_t len)
     }
     if (n > 0 && self->abs_pos != -1)
         self->abs_pos += n;
+    if (n == len && len >= READAHEAD_MIN_SIZE && self->fast_closed_checks &&
+        start_pos != -1 && start_pos == self->readahead_pos) {
+        _PyFileIO_readahead(self->raw, self->abs_pos, len);
+    }
+    self->readahead_pos = self->abs_pos;
     return n;
 }
 
@@ -83,6 +83,20 @@ _PyFileIO_closed(PyObject *self)
     return ((fileio *)self)->fd < 0;
 }
 
+void
+_PyFileIO_readahead(PyObject *self, Py_off_t offset, Py_ssize_t len)
+{
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+    int fd = ((fileio *)self)->fd;
+    if (fd < 0)
+        return;
+    /* Only a hint: errors (e.g. ESPIPE) are ignored. */
+    Py_BEGIN_ALLOW_THREADS
+    (void)posix_fadvise(fd, (off_t)offset, (off_t)len, POSIX_FADV_WILLNEED);
+    Py_END_ALLOW_THREADS
+#endif
+}
+
 /* Because this can call arbitrary code, it shouldn't be called when
    the refcount is 0 (that is, not directly from tp_dealloc unless
    the refcount has been temporarily re-incremented). */
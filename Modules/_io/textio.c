@@ -2088,6 +2088,9 @@ find_control_char(int kind, const char *s, const char *end, Py_UCS4 ch)
     }
 }
 
+/* Number of characters searched at once for universal newlines. */
+#define UNIVERSAL_SCAN_BLOCK 256
+
 Py_ssize_t
 _PyIO_find_line_ending(
     int translated, int universal, PyObject *readnl,
@@ -2110,6 +2113,28 @@ _PyIO_find_line_ending(
          * The decoder ensures that \r\n are not split in two pieces
          */
         const char *s = start;
+        if (kind == PyUnicode_1BYTE_KIND) {
+            /* Use the libc's optimized memchr() for both characters, block
+               by block so that a missing one doesn't make us scan the
+               whole buffer for each line. */
+            while (s < end) {
+                const char *e = (end - s > UNIVERSAL_SCAN_BLOCK) ?
+                                s + UNIVERSAL_SCAN_BLOCK : end;
+                const char *lf = memchr(s, '\n', e - s);
+                const char *cr = memchr(s, '\r', (lf != NULL ? lf : e) - s);
+                if (cr != NULL) {
+                    /* The string is NUL-terminated, so cr[1] is valid */
+                    if (cr[1] == '\n')
+                        return cr - start + 2;
+                    return cr - start + 1;
+                }
+                if (lf != NULL)
+                    return lf - start + 1;
+                s = e;
+            }
+            *consumed = len;
+            return -1;
+        }
         for (;;) {
             Py_UCS4 ch;
             /* Fast path for non-control chars. The loop always ends
@@ -25,6 +25,7 @@ typedef struct _PyScannerObject {
     PyObject *parse_int;
     PyObject *parse_constant;
     PyObject *memo;
+    Py_ssize_t key_cache_size;
 } PyScannerObject;
 
 static PyMemberDef scanner_members[] = {
@@ -34,6 +35,7 @@ static PyMemberDef scanner_members[] = {
     {"parse_float", T_OBJECT, offsetof(PyScannerObject, parse_float), READONLY, "parse_float"},
     {"parse_int", T_OBJECT, offsetof(PyScannerObject, parse_int), READONLY, "parse_int"},
     {"parse_constant", T_OBJECT, offsetof(PyScannerObject, parse_constant), READONLY, "parse_constant"},
+    {"key_cache_size", T_PYSSIZET, offsetof(PyScannerObject, key_cache_size), READONLY, "key_cache_size"},
     {NULL}
 };
 
@@ -86,11 +88,11 @@ encoder_dealloc(PyObject *self);
 static int
 encoder_clear(PyEncoderObject *self);
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *seq, Py_ssize_t indent_level);
+encoder_listencode_list(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *write, PyObject *seq, Py_ssize_t indent_level);
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *obj, Py_ssize_t indent_level);
+encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *write, PyObject *obj, Py_ssize_t indent_level);
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *dct, Py_ssize_t indent_level);
+encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *write, PyObject *dct, Py_ssize_t indent_level);
 static PyObject *
 _encoded_const(PyObject *obj);
 static void
@@ -302,6 +304,34 @@ escape_unicode(PyObject *pystr)
     return rval;
 }
 
+/* The scanner reads either a str or a bytes object holding UTF-8 encoded
+   text.  Every character with a meaning in JSON is ASCII, and no byte of a
+   multi-byte UTF-8 sequence is ASCII, so UTF-8 is scanned as one-byte text
+   and only the contents of strings need decoding.  Indices into bytes are
+   byte offsets. */
+static inline const void *
+scan_input_data(PyObject *pystr, int *kind, Py_ssize_t *length)
+{
+    if (PyBytes_Check(pystr)) {
+        *kind = PyUnicode_1BYTE_KIND;
+        *length = PyBytes_GET_SIZE(pystr);
+        return PyBytes_AS_STRING(pystr);
+    }
+    *kind = PyUnicode_KIND(pystr);
+    *length = PyUnicode_GET_LENGTH(pystr);
+    return PyUnicode_DATA(pystr);
+}
+
+static PyObject *
+scan_input_substring(PyObject *pystr, Py_ssize_t start, Py_ssize_t end)
+{
+    if (PyBytes_Check(pystr)) {
+        return PyUnicode_DecodeUTF8(PyBytes_AS_STRING(pystr) + start,
+                                    end - start, "surrogatepass");
+    }
+    return PyUnicode_Substring(pystr, start, end);
+}
+
 static void
 raise_errmsg(const char *msg, PyObject *s, Py_ssize_t end)
 {
@@ -314,7 +344,25 @@ raise_errmsg(const char *msg, PyObject *s, Py_ssize_t end)
     }
 
     PyObject *exc;
-    exc = PyObject_CallFunction(JSONDecodeError, "zOn", msg, s, end);
+    if (PyBytes_Check(s)) {
+        /* Report the error against the decoded document, converting the
+           byte offset to a character offset. */
+        const char *buf = PyBytes_AS_STRING(s);
+        Py_ssize_t i, pos = 0;
+        for (i = 0; i < end; i++) {
+            pos += ((buf[i] & 0xC0) != 0x80);
+        }
+        PyObject *doc = PyUnicode_DecodeUTF8(buf, PyBytes_GET_SIZE(s),
+                                             "surrogatepass");
+        if (doc == NULL) {
+            Py_DECREF(JSONDecodeError);
+            return;
+        }
+        exc = PyObject_CallFunction(JSONDecodeError, "zNn", msg, doc, pos);
+    }
+    else {
+        exc = PyObject_CallFunction(JSONDecodeError, "zOn", msg, s, end);
+    }
     Py_DECREF(JSONDecodeError);
     if (exc) {
         PyErr_SetObject(JSONDecodeError, exc);
@@ -359,6 +407,49 @@ _build_rval_index_tuple(PyObject *rval, Py_ssize_t idx) {
     return tpl;
 }
 
+/* Word-at-a-time helpers for scanning UCS1 strings: non-zero if any byte
+   of the word v is zero (resp. less than n, which must not exceed 0x80). */
+#define SCAN_ONES ((size_t)-1 / 0xFF)
+#define SCAN_HIGHS (SCAN_ONES * 0x80)
+#define SCAN_HAS_ZERO(v) (((v) - SCAN_ONES) & ~(v) & SCAN_HIGHS)
+#define SCAN_HAS_LESS(v, n) (((v) - SCAN_ONES * (n)) & ~(v) & SCAN_HIGHS)
+
+static Py_ssize_t
+scanstring_find_special_ucs1(const Py_UCS1 *s, Py_ssize_t start,
+                             Py_ssize_t len, int strict)
+{
+    /* Return the index of the first '"' or '\\' in s[start:len], or of
+       the first control character if strict is set.  Return len if there
+       is none.  Escape-free runs are skipped a machine word at a time. */
+    const size_t quote = SCAN_ONES * '"';
+    const size_t backslash = SCAN_ONES * '\\';
+    Py_ssize_t i = start;
+    while (i + (Py_ssize_t)SIZEOF_SIZE_T <= len) {
+        size_t v;
+        memcpy(&v, s + i, SIZEOF_SIZE_T);
+        size_t mask = SCAN_HAS_ZERO(v ^ quote) | SCAN_HAS_ZERO(v ^ backslash);
+        if (strict) {
+            mask |= SCAN_HAS_LESS(v, 0x20);
+        }
+        if (mask) {
+            break;
+        }
+        i += SIZEOF_SIZE_T;
+    }
+    for (; i < len; i++) {
+        Py_UCS1 c = s[i];
+        if (c == '"' || c == '\\' || (c <= 0x1f && strict)) {
+            break;
+        }
+    }
+    return i;
+}
+
+#undef SCAN_ONES
+#undef SCAN_HIGHS
+#undef SCAN_HAS_ZERO
+#undef SCAN_HAS_LESS
+
 static PyObject *
 scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next_end_ptr)
 {
@@ -384,9 +475,7 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
     _PyUnicodeWriter_Init(&writer);
     writer.overallocate = 1;
 
-    len = PyUnicode_GET_LENGTH(pystr);
-    buf = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
+    buf = scan_input_data(pystr, &kind, &len);
 
     if (end < 0 || len < end) {
         PyErr_SetString(PyExc_ValueError, "end is out of bounds");
@@ -395,7 +484,17 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
     while (1) {
         /* Find the end of the string or the next escape */
         Py_UCS4 c;
-        {
+        if (kind == PyUnicode_1BYTE_KIND) {
+            next = scanstring_find_special_ucs1((const Py_UCS1 *)buf,
+                                                end, len, strict);
+            c = next < len ? ((const Py_UCS1 *)buf)[next] : 0;
+            if (c <= 0x1f && next < len) {
+                assert(strict);
+                raise_errmsg("Invalid control character at", pystr, next);
+                goto bail;
+            }
+        }
+        else {
             // Use tight scope variable to help register allocation.
             Py_UCS4 d = 0;
             for (next = end; next < len; next++) {
@@ -414,7 +513,7 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
         if (c == '"') {
             // Fast path for simple case.
             if (writer.buffer == NULL) {
-                PyObject *ret = PyUnicode_Substring(pystr, end, next);
+                PyObject *ret = scan_input_substring(pystr, end, next);
                 if (ret == NULL) {
                     goto bail;
                 }
@@ -429,7 +528,18 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
 
         /* Pick up this chunk if it's not zero length */
         if (next != end) {
-            if (_PyUnicodeWriter_WriteSubstring(&writer, pystr, end, next) < 0) {
+            if (PyBytes_Check(pystr)) {
+                PyObject *chunk = scan_input_substring(pystr, end, next);
+                if (chunk == NULL) {
+                    goto bail;
+                }
+                int res = _PyUnicodeWriter_WriteStr(&writer, chunk);
+                Py_DECREF(chunk);
+                if (res < 0) {
+                    goto bail;
+                }
+            }
+            else if (_PyUnicodeWriter_WriteSubstring(&writer, pystr, end, next) < 0) {
                 goto bail;
             }
         }
@@ -668,7 +778,7 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     */
     const void *str;
     int kind;
-    Py_ssize_t end_idx;
+    Py_ssize_t length, end_idx;
     PyObject *val = NULL;
     PyObject *rval = NULL;
     PyObject *key = NULL;
@@ -678,9 +788,8 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     if (PyUnicode_READY(pystr) == -1)
         return NULL;
 
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
+    str = scan_input_data(pystr, &kind, &length);
+    end_idx = length - 1;
 
     if (has_pairs_hook)
         rval = PyList_New(0);
@@ -796,7 +905,7 @@ _parse_array_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssi
     */
     const void *str;
     int kind;
-    Py_ssize_t end_idx;
+    Py_ssize_t length, end_idx;
     PyObject *val = NULL;
     PyObject *rval;
     Py_ssize_t next_idx;
@@ -808,9 +917,8 @@ _parse_array_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssi
     if (rval == NULL)
         return NULL;
 
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
+    str = scan_input_data(pystr, &kind, &length);
+    end_idx = length - 1;
 
     /* skip whitespace after [ */
     while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
@@ -886,6 +994,9 @@ _parse_constant(PyScannerObject *s, const char *constant, Py_ssize_t idx, Py_ssi
     return rval;
 }
 
+/* Numbers shorter than this are converted without a temporary object. */
+#define NUMBER_BUFFER_SIZE 64
+
 static PyObject *
 _match_number_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t start, Py_ssize_t *next_idx_ptr) {
     /* Read a JSON number from PyUnicode pystr.
@@ -899,7 +1010,7 @@ _match_number_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t start, Py_
     */
     const void *str;
     int kind;
-    Py_ssize_t end_idx;
+    Py_ssize_t length, end_idx;
     Py_ssize_t idx = start;
     int is_float = 0;
     PyObject *rval;
@@ -909,9 +1020,8 @@ _match_number_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t start, Py_
     if (PyUnicode_READY(pystr) == -1)
         return NULL;
 
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
+    str = scan_input_data(pystr, &kind, &length);
+    end_idx = length - 1;
 
     /* read a sign if it's there, make sure it's not the end of the string */
     if (PyUnicode_READ(kind, str, idx) == '-') {
@@ -980,6 +1090,42 @@ _match_number_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t start, Py_
             return NULL;
         rval = PyObject_CallOneArg(custom_func, numstr);
     }
+    else if (idx - start < NUMBER_BUFFER_SIZE) {
+        /* Common case: convert short numbers from a stack buffer, without
+           creating an intermediate bytes object. */
+        char buf[NUMBER_BUFFER_SIZE];
+        Py_ssize_t i, n = idx - start;
+        if (kind == PyUnicode_1BYTE_KIND) {
+            memcpy(buf, (const Py_UCS1 *)str + start, n);
+        }
+        else {
+            for (i = 0; i < n; i++) {
+                buf[i] = (char) PyUnicode_READ(kind, str, i + start);
+            }
+        }
+        buf[n] = '\0';
+        if (is_float) {
+            double d = PyOS_string_to_double(buf, NULL, NULL);
+            if (d == -1.0 && PyErr_Occurred()) {
+                return NULL;
+            }
+            rval = PyFloat_FromDouble(d);
+        }
+        else if (n <= 18) {
+            /* At most 18 digits always fits in a long long. */
+            long long value = 0;
+            i = (buf[0] == '-');
+            for (; i < n; i++) {
+                value = value * 10 + (buf[i] - '0');
+            }
+            rval = PyLong_FromLongLong(buf[0] == '-' ? -value : value);
+        }
+        else {
+            rval = PyLong_FromString(buf, NULL, 10);
+        }
+        *next_idx_ptr = idx;
+        return rval;
+    }
     else {
         Py_ssize_t i, n;
         char *buf;
@@ -1021,9 +1167,7 @@ scan_once_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssize_
     if (PyUnicode_READY(pystr) == -1)
         return NULL;
 
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    length = PyUnicode_GET_LENGTH(pystr);
+    str = scan_input_data(pystr, &kind, &length);
 
     if (idx < 0) {
         PyErr_SetString(PyExc_ValueError, "idx cannot be negative");
@@ -1127,16 +1271,20 @@ scanner_call(PyScannerObject *self, PyObject *args, PyObject *kwds)
     if (!PyArg_ParseTupleAndKeywords(args, kwds, "On:scan_once", kwlist, &pystr, &idx))
         return NULL;
 
-    if (PyUnicode_Check(pystr)) {
+    if (PyUnicode_Check(pystr) || PyBytes_Check(pystr)) {
         rval = scan_once_unicode(self, pystr, idx, &next_idx);
     }
     else {
         PyErr_Format(PyExc_TypeError,
-                 "first argument must be a string, not %.80s",
+                 "first argument must be a string or bytes, not %.80s",
                  Py_TYPE(pystr)->tp_name);
         return NULL;
     }
-    PyDict_Clear(self->memo);
+    /* Keys are remembered across calls until there are more than
+       key_cache_size of them. */
+    if (PyDict_GET_SIZE(self->memo) > self->key_cache_size) {
+        PyDict_Clear(self->memo);
+    }
     if (rval == NULL)
         return NULL;
     return _build_rval_index_tuple(rval, next_idx);
@@ -1185,6 +1333,25 @@ scanner_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     s->parse_constant = PyObject_GetAttrString(ctx, "parse_constant");
     if (s->parse_constant == NULL)
         goto bail;
+    /* key_cache_size is optional and defaults to 0 (no caching). */
+    PyObject *key_cache_size = PyObject_GetAttrString(ctx, "key_cache_size");
+    if (key_cache_size == NULL) {
+        if (!PyErr_ExceptionMatches(PyExc_AttributeError))
+            goto bail;
+        PyErr_Clear();
+    }
+    else {
+        s->key_cache_size = PyNumber_AsSsize_t(key_cache_size,
+                                               PyExc_OverflowError);
+        Py_DECREF(key_cache_size);
+        if (s->key_cache_size == -1 && PyErr_Occurred())
+            goto bail;
+        if (s->key_cache_size < 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "key_cache_size must be non-negative");
+            goto bail;
+        }
+    }
 
     return (PyObject *)s;
 
@@ -1263,27 +1430,69 @@ encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     return (PyObject *)s;
 }
 
+/* When encoding to a stream, output is passed to its write() method in
+   chunks of at least this many characters. */
+#define ENCODER_FLUSH_SIZE 8192
+
+static int
+encoder_flush(_PyUnicodeWriter *writer, PyObject *write, Py_ssize_t min_size)
+{
+    /* Pass the accumulated output to write (if not NULL) once there is at
+       least min_size characters of it, and start over with an empty
+       writer. */
+    if (write == NULL || writer->pos == 0 || writer->pos < min_size) {
+        return 0;
+    }
+    PyObject *chunk = _PyUnicodeWriter_Finish(writer);
+    _PyUnicodeWriter_Init(writer);
+    writer->overallocate = 1;
+    if (chunk == NULL) {
+        return -1;
+    }
+    PyObject *res = PyObject_CallOneArg(write, chunk);
+    Py_DECREF(chunk);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
+}
+
 static PyObject *
 encoder_call(PyEncoderObject *self, PyObject *args, PyObject *kwds)
 {
     /* Python callable interface to encode_listencode_obj */
-    static char *kwlist[] = {"obj", "_current_indent_level", NULL};
+    static char *kwlist[] = {"obj", "_current_indent_level", "write", NULL};
     PyObject *obj, *result;
+    PyObject *write = Py_None;
     Py_ssize_t indent_level;
     _PyUnicodeWriter writer;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "On:_iterencode", kwlist,
-        &obj, &indent_level))
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "On|O:_iterencode", kwlist,
+        &obj, &indent_level, &write))
         return NULL;
+    if (write == Py_None) {
+        write = NULL;
+    }
 
     _PyUnicodeWriter_Init(&writer);
     writer.overallocate = 1;
 
-    if (encoder_listencode_obj(self, &writer, obj, indent_level)) {
+    if (encoder_listencode_obj(self, &writer, write, obj, indent_level)) {
         _PyUnicodeWriter_Dealloc(&writer);
         return NULL;
     }
 
+    if (write != NULL) {
+        /* Pass on whatever is left and return None. */
+        if (encoder_flush(&writer, write, 0) < 0) {
+            _PyUnicodeWriter_Dealloc(&writer);
+            return NULL;
+        }
+        _PyUnicodeWriter_Dealloc(&writer);
+        Py_RETURN_NONE;
+    }
+
     result = PyTuple_New(1);
     if (result == NULL ||
             PyTuple_SetItem(result, 0, _PyUnicodeWriter_Finish(&writer)) < 0) {
@@ -1370,7 +1579,7 @@ _steal_accumulate(_PyUnicodeWriter *writer, PyObject *stolen)
 
 static int
 encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer,
-                       PyObject *obj, Py_ssize_t indent_level)
+                       PyObject *write, PyObject *obj, Py_ssize_t indent_level)
 {
     /* Encode Python object obj to a JSON term */
     PyObject *newobj;
@@ -1406,14 +1615,14 @@ encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer,
     else if (PyList_Check(obj) || PyTuple_Check(obj)) {
         if (_Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_list(s, writer, obj, indent_level);
+        rv = encoder_listencode_list(s, writer, write, obj, indent_level);
         _Py_LeaveRecursiveCall();
         return rv;
     }
     else if (PyDict_Check(obj)) {
         if (_Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_dict(s, writer, obj, indent_level);
+        rv = encoder_listencode_dict(s, writer, write, obj, indent_level);
         _Py_LeaveRecursiveCall();
         return rv;
     }
@@ -1447,7 +1656,7 @@ encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer,
             Py_XDECREF(ident);
             return -1;
         }
-        rv = encoder_listencode_obj(s, writer, newobj, indent_level);
+        rv = encoder_listencode_obj(s, writer, write, newobj, indent_level);
         _Py_LeaveRecursiveCall();
 
         Py_DECREF(newobj);
@@ -1467,7 +1676,8 @@ encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer,
 }
 
 static int
-encoder_encode_key_value(PyEncoderObject *s, _PyUnicodeWriter *writer, bool *first,
+encoder_encode_key_value(PyEncoderObject *s, _PyUnicodeWriter *writer,
+                         PyObject *write, bool *first,
                          PyObject *key, PyObject *value, Py_ssize_t indent_level)
 {
     PyObject *keystr = NULL;
@@ -1523,7 +1733,10 @@ encoder_encode_key_value(PyEncoderObject *s, _PyUnicodeWriter *writer, bool *fir
     if (_PyUnicodeWriter_WriteStr(writer, s->key_separator) < 0) {
         return -1;
     }
-    if (encoder_listencode_obj(s, writer, value, indent_level) < 0) {
+    if (encoder_listencode_obj(s, writer, write, value, indent_level) < 0) {
+        return -1;
+    }
+    if (encoder_flush(writer, write, ENCODER_FLUSH_SIZE) < 0) {
         return -1;
     }
     return 0;
@@ -1531,7 +1744,7 @@ encoder_encode_key_value(PyEncoderObject *s, _PyUnicodeWriter *writer, bool *fir
 
 static int
 encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer,
-                        PyObject *dct, Py_ssize_t indent_level)
+                        PyObject *write, PyObject *dct, Py_ssize_t indent_level)
 {
     /* Encode Python dict dct a JSON term */
     PyObject *ident = NULL;
@@ -1586,7 +1799,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer,
 
             key = PyTuple_GET_ITEM(item, 0);
             value = PyTuple_GET_ITEM(item, 1);
-            if (encoder_encode_key_value(s, writer, &first, key, value, indent_level) < 0)
+            if (encoder_encode_key_value(s, writer, write, &first, key, value, indent_level) < 0)
                 goto bail;
         }
         Py_CLEAR(items);
@@ -1594,7 +1807,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer,
     } else {
         Py_ssize_t pos = 0;
         while (PyDict_Next(dct, &pos, &key, &value)) {
-            if (encoder_encode_key_value(s, writer, &first, key, value, indent_level) < 0)
+            if (encoder_encode_key_value(s, writer, write, &first, key, value, indent_level) < 0)
                 goto bail;
         }
     }
@@ -1622,7 +1835,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer,
 
 static int
 encoder_listencode_list(PyEncoderObject *s, _PyUnicodeWriter *writer,
-                        PyObject *seq, Py_ssize_t indent_level)
+                        PyObject *write, PyObject *seq, Py_ssize_t indent_level)
 {
     PyObject *ident = NULL;
     PyObject *s_fast = NULL;
@@ -1670,7 +1883,9 @@ encoder_listencode_list(PyEncoderObject *s, _PyUnicodeWriter *writer,
             if (_PyUnicodeWriter_WriteStr(writer, s->item_separator))
                 goto bail;
         }
-        if (encoder_listencode_obj(s, writer, obj, indent_level))
+        if (encoder_listencode_obj(s, writer, write, obj, indent_level))
+            goto bail;
+        if (encoder_flush(writer, write, ENCODER_FLUSH_SIZE))
             goto bail;
     }
     if (ident != NULL) {
@@ -11,6 +11,7 @@
 #include "Python.h"
 #include "pycore_ceval.h"         // _Py_EnterRecursiveCall()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
+#include "pycore_object.h"        // _PyObject_StoreInstanceAttribute()
 #include "pycore_runtime.h"       // _Py_ID()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "structmember.h"         // PyMemberDef
@@ -6633,6 +6634,61 @@ load_additems(PickleState *state, UnpicklerObject *self)
     return 0;
 }
 
+/* Fast path for the default __setstate__ of an instance whose attributes
+   still live in its inline values array (a plain class with a managed
+   __dict__).  Store the state items there directly rather than through
+   inst.__dict__, since materializing the dict would make the instance
+   bigger and every later attribute access slower.
+
+   Returns 1 if the state was stored, 0 if the generic path must be used
+   and -1 on error. */
+static int
+load_build_inline_values(PyObject *inst, PyObject *state)
+{
+    PyTypeObject *tp = Py_TYPE(inst);
+    PyObject *descr, *d_key, *d_value;
+    PyDictOrValues *dorv_ptr;
+    Py_ssize_t i;
+
+    if (!(tp->tp_flags & Py_TPFLAGS_MANAGED_DICT) ||
+        tp->tp_getattro != PyObject_GenericGetAttr)
+    {
+        return 0;
+    }
+    dorv_ptr = _PyObject_DictOrValuesPointer(inst);
+    if (!_PyDictOrValues_IsValues(*dorv_ptr)) {
+        return 0;
+    }
+    /* inst.__dict__ must not be overridden by the class. */
+    descr = _PyType_Lookup(tp, &_Py_ID(__dict__));
+    if (descr == NULL || !Py_IS_TYPE(descr, &PyGetSetDescr_Type)) {
+        return 0;
+    }
+
+    i = 0;
+    while (PyDict_Next(state, &i, &d_key, &d_value)) {
+        int res;
+
+        Py_INCREF(d_key);
+        if (PyUnicode_CheckExact(d_key))
+            PyUnicode_InternInPlace(&d_key);
+        /* A key that does not fit in the shared keys materializes the
+           dict, after which the remaining items go there. */
+        if (_PyDictOrValues_IsValues(*dorv_ptr)) {
+            res = _PyObject_StoreInstanceAttribute(
+                inst, _PyDictOrValues_GetValues(*dorv_ptr), d_key, d_value);
+        }
+        else {
+            res = PyDict_SetItem(_PyDictOrValues_GetDict(*dorv_ptr),
+                                 d_key, d_value);
+        }
+        Py_DECREF(d_key);
+        if (res < 0)
+            return -1;
+    }
+    return 1;
+}
+
 static int
 load_build(PickleState *st, UnpicklerObject *self)
 {
@@ -6694,6 +6750,11 @@ load_build(PickleState *st, UnpicklerObject *self)
             PyErr_SetString(st->UnpicklingError, "state is not a dictionary");
             goto error;
         }
+        i = load_build_inline_values(inst, state);
+        if (i < 0)
+            goto error;
+        if (i > 0)
+            goto slots;
         dict = PyObject_GetAttr(inst, &_Py_ID(__dict__));
         if (dict == NULL)
             goto error;
@@ -6714,6 +6775,7 @@ load_build(PickleState *st, UnpicklerObject *self)
         Py_DECREF(dict);
     }
 
+  slots:
     /* Also set instance attributes from the slotstate dict (if any). */
     if (slotstate != NULL) {
         PyObject *d_key, *d_value;
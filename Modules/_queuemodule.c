@@ -153,6 +153,50 @@ _queue_SimpleQueue_put_nowait_impl(simplequeueobject *self, PyObject *item)
     return _queue_SimpleQueue_put_impl(self, item, 0, Py_None);
 }
 
+/*[clinic input]
+_queue.SimpleQueue.put_many
+    items: object
+    /
+
+Put all the items of an iterable on the queue, in order.
+
+The items are added at once: a concurrent get() sees either none or
+all of them.  This method never blocks.
+[clinic start generated code]*/
+
+static PyObject *
+_queue_SimpleQueue_put_many(simplequeueobject *self, PyObject *items)
+/*[clinic end generated code: output=5f53df0b226d2025 input=06fe7adebc9f8186]*/
+{
+    PyObject *fast;
+    Py_ssize_t n;
+
+    /* Collect the items first so that no Python code runs while they are
+       being appended. */
+    fast = PySequence_Fast(items, "put_many() argument must be an iterable");
+    if (fast == NULL) {
+        return NULL;
+    }
+    n = PySequence_Fast_GET_SIZE(fast);
+    /* BEGIN GIL-protected critical section */
+    /* Append all the items in a single step, which either succeeds or
+       leaves the list unchanged: no item is left queued without waking up
+       the getters. */
+    if (PyList_SetSlice(self->lst, PY_SSIZE_T_MAX, PY_SSIZE_T_MAX,
+                        fast) < 0) {
+        Py_DECREF(fast);
+        return NULL;
+    }
+    if (n > 0 && self->locked) {
+        /* A get() may be waiting, wake it up */
+        self->locked = 0;
+        PyThread_release_lock(self->lock);
+    }
+    /* END GIL-protected critical section */
+    Py_DECREF(fast);
+    Py_RETURN_NONE;
+}
+
 static PyObject *
 simplequeue_pop_item(simplequeueobject *self)
 {
@@ -180,34 +224,16 @@ simplequeue_pop_item(simplequeueobject *self)
     return item;
 }
 
-/*[clinic input]
-_queue.SimpleQueue.get
-
-    cls: defining_class
-    /
-    block: bool = True
-    timeout as timeout_obj: object = None
-
-Remove and return an item from the queue.
-
-If optional args 'block' is true and 'timeout' is None (the default),
-block if necessary until an item is available. If 'timeout' is
-a non-negative number, it blocks at most 'timeout' seconds and raises
-the Empty exception if no item was available within that time.
-Otherwise ('block' is false), return an item if one is immediately
-available, else raise the Empty exception ('timeout' is ignored
-in that case).
-
-[clinic start generated code]*/
-
-static PyObject *
-_queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
-                            int block, PyObject *timeout_obj)
-/*[clinic end generated code: output=5c2cca914cd1e55b input=5b4047bfbc645ec1]*/
+/* Wait until the queue is non-empty, following the 'block' and 'timeout'
+   semantics of get().  Return 0 on success, or -1 with an exception set
+   (the Empty exception if the timeout expired).  On success, the caller
+   must call simplequeue_release_waiter() once it has removed its items. */
+static int
+simplequeue_wait(simplequeueobject *self, PyTypeObject *cls,
+                 int block, PyObject *timeout_obj)
 {
     _PyTime_t endtime = 0;
     _PyTime_t timeout;
-    PyObject *item;
     PyLockStatus r;
     PY_TIMEOUT_T microseconds;
     PyThreadState *tstate = PyThreadState_Get();
@@ -220,19 +246,19 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
         /* With timeout */
         if (_PyTime_FromSecondsObject(&timeout,
                                       timeout_obj, _PyTime_ROUND_CEILING) < 0) {
-            return NULL;
+            return -1;
         }
         if (timeout < 0) {
             PyErr_SetString(PyExc_ValueError,
                             "'timeout' must be a non-negative number");
-            return NULL;
+            return -1;
         }
         microseconds = _PyTime_AsMicroseconds(timeout,
                                               _PyTime_ROUND_CEILING);
         if (microseconds > PY_TIMEOUT_MAX) {
             PyErr_SetString(PyExc_OverflowError,
                             "timeout value is too large");
-            return NULL;
+            return -1;
         }
         endtime = _PyDeadline_Init(timeout);
     }
@@ -255,14 +281,14 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
         }
 
         if (r == PY_LOCK_INTR && _PyEval_MakePendingCalls(tstate) < 0) {
-            return NULL;
+            return -1;
         }
         if (r == PY_LOCK_FAILURE) {
             PyObject *module = PyType_GetModule(cls);
             simplequeue_state *state = simplequeue_get_state(module);
             /* Timed out */
             PyErr_SetNone(state->EmptyError);
-            return NULL;
+            return -1;
         }
         self->locked = 1;
 
@@ -274,18 +300,127 @@ _queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
         }
     }
 
-    /* BEGIN GIL-protected critical section */
-    assert(self->lst_pos < PyList_GET_SIZE(self->lst));
-    item = simplequeue_pop_item(self);
+    return 0;
+}
+
+static void
+simplequeue_release_waiter(simplequeueobject *self)
+{
     if (self->locked) {
         PyThread_release_lock(self->lock);
         self->locked = 0;
     }
+}
+
+/*[clinic input]
+_queue.SimpleQueue.get
+
+    cls: defining_class
+    /
+    block: bool = True
+    timeout as timeout_obj: object = None
+
+Remove and return an item from the queue.
+
+If optional args 'block' is true and 'timeout' is None (the default),
+block if necessary until an item is available. If 'timeout' is
+a non-negative number, it blocks at most 'timeout' seconds and raises
+the Empty exception if no item was available within that time.
+Otherwise ('block' is false), return an item if one is immediately
+available, else raise the Empty exception ('timeout' is ignored
+in that case).
+
+[clinic start generated code]*/
+
+static PyObject *
+_queue_SimpleQueue_get_impl(simplequeueobject *self, PyTypeObject *cls,
+                            int block, PyObject *timeout_obj)
+/*[clinic end generated code: output=5c2cca914cd1e55b input=5b4047bfbc645ec1]*/
+{
+    PyObject *item;
+
+    if (simplequeue_wait(self, cls, block, timeout_obj) < 0) {
+        return NULL;
+    }
+
+    /* BEGIN GIL-protected critical section */
+    assert(self->lst_pos < PyList_GET_SIZE(self->lst));
+    item = simplequeue_pop_item(self);
+    simplequeue_release_waiter(self);
     /* END GIL-protected critical section */
 
     return item;
 }
 
+/*[clinic input]
+_queue.SimpleQueue.get_many
+
+    cls: defining_class
+    max_items: Py_ssize_t
+    /
+    block: bool = True
+    timeout as timeout_obj: object = None
+
+Remove and return a list of up to 'max_items' items from the queue.
+
+Wait for the first item like get() does, then also take whichever
+other items are immediately available, up to 'max_items' in total.
+[clinic start generated code]*/
+
+static PyObject *
+_queue_SimpleQueue_get_many_impl(simplequeueobject *self, PyTypeObject *cls,
+                                 Py_ssize_t max_items, int block,
+                                 PyObject *timeout_obj)
+/*[clinic end generated code: output=5db4d0fe54081e21 input=812c3027efe39216]*/
+{
+    PyObject *items;
+    Py_ssize_t i, n, end;
+
+    if (max_items <= 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "'max_items' must be a positive number");
+        return NULL;
+    }
+    if (simplequeue_wait(self, cls, block, timeout_obj) < 0) {
+        return NULL;
+    }
+
+    /* BEGIN GIL-protected critical section */
+    n = PyList_GET_SIZE(self->lst) - self->lst_pos;
+    assert(n > 0);
+    if (n > max_items) {
+        n = max_items;
+    }
+    end = self->lst_pos + n;
+    items = PyList_GetSlice(self->lst, self->lst_pos, end);
+    if (items == NULL) {
+        simplequeue_release_waiter(self);
+        return NULL;
+    }
+    /* The items are kept alive by the new list, so replacing them can't
+       run arbitrary code. */
+    for (i = self->lst_pos; i < end; i++) {
+        PyObject *item = PyList_GET_ITEM(self->lst, i);
+        PyList_SET_ITEM(self->lst, i, Py_NewRef(Py_None));
+        Py_DECREF(item);
+    }
+    self->lst_pos = end;
+    if (self->lst_pos > PyList_GET_SIZE(self->lst) - self->lst_pos) {
+        /* The list is more than 50% empty, reclaim space at the beginning.
+           On failure, a later get() will try again. */
+        if (PyList_SetSlice(self->lst, 0, self->lst_pos, NULL) < 0) {
+            PyErr_Clear();
+        }
+        else {
+            self->lst_pos = 0;
+        }
+    }
+    simplequeue_release_waiter(self);
+    /* END GIL-protected critical section */
+
+    return items;
+}
+
 /*[clinic input]
 _queue.SimpleQueue.get_nowait
 
@@ -362,8 +497,10 @@ queue_free(void *m)
 static PyMethodDef simplequeue_methods[] = {
     _QUEUE_SIMPLEQUEUE_EMPTY_METHODDEF
     _QUEUE_SIMPLEQUEUE_GET_METHODDEF
+    _QUEUE_SIMPLEQUEUE_GET_MANY_METHODDEF
     _QUEUE_SIMPLEQUEUE_GET_NOWAIT_METHODDEF
     _QUEUE_SIMPLEQUEUE_PUT_METHODDEF
+    _QUEUE_SIMPLEQUEUE_PUT_MANY_METHODDEF
     _QUEUE_SIMPLEQUEUE_PUT_NOWAIT_METHODDEF
     _QUEUE_SIMPLEQUEUE_QSIZE_METHODDEF
     {"__class_getitem__",    Py_GenericAlias,
@@ -10,6 +10,7 @@
 #define PY_SSIZE_T_CLEAN
 
 #include "Python.h"
+#include "pycore_import.h"        // _PyImport_GetModuleAttrString()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "structmember.h"         // PyMemberDef
 #include <ctype.h>
@@ -1908,6 +1909,182 @@ Struct_iter_unpack(PyStructObject *self, PyObject *buffer)
 }
 
 
+/* Return the array.array typecode that holds values of format e, or 0
+   if there is none. */
+static int
+column_typecode(const formatdef *e)
+{
+    static const char signed_codes[] = "bhilq";
+    static const size_t signed_sizes[] = {
+        1, sizeof(short), sizeof(int), sizeof(long), sizeof(long long)};
+    size_t size = (size_t)e->size;
+    int is_signed;
+
+    switch (e->format) {
+    case 'f':
+    case 'd':
+        if (size == sizeof(float))
+            return 'f';
+        if (size == sizeof(double))
+            return 'd';
+        return 0;
+    case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+        is_signed = 1;
+        break;
+    case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N': case 'P':
+        is_signed = 0;
+        break;
+    default:
+        return 0;
+    }
+    for (size_t k = 0; k < Py_ARRAY_LENGTH(signed_sizes); k++) {
+        if (signed_sizes[k] == size) {
+            return is_signed ? signed_codes[k]
+                             : Py_TOUPPER(signed_codes[k]);
+        }
+    }
+    return 0;
+}
+
+/* Copy n items of itemsize bytes, stride bytes apart, into dst. */
+static void
+gather_column(char *dst, const char *src, Py_ssize_t itemsize,
+              Py_ssize_t stride, Py_ssize_t n)
+{
+#define GATHER(SIZE) \
+    for (; n > 0; n--, dst += (SIZE), src += stride) \
+        memcpy(dst, src, (SIZE))
+
+    if (itemsize == stride) {
+        memcpy(dst, src, itemsize * n);
+        return;
+    }
+    /* Constant sizes let the compiler turn memcpy() into single moves */
+    switch (itemsize) {
+    case 1: GATHER(1); break;
+    case 2: GATHER(2); break;
+    case 4: GATHER(4); break;
+    case 8: GATHER(8); break;
+    default: GATHER(itemsize); break;
+    }
+#undef GATHER
+}
+
+/*[clinic input]
+Struct.unpack_into_columns
+
+    buffer: Py_buffer
+    /
+
+Return a tuple of array.array objects, one per unpacked field.
+
+The i-th array holds the i-th field of every record in the buffer, as
+if each record had been unpacked with unpack_from(), but without
+creating a tuple per record.  Only integer and float formats are
+supported.
+
+Requires that the bytes length be a multiple of the struct size.
+[clinic start generated code]*/
+
+static PyObject *
+Struct_unpack_into_columns_impl(PyStructObject *self, Py_buffer *buffer)
+/*[clinic end generated code: output=6a5cc6a2c32d583f input=36e515e3068b482a]*/
+{
+    _structmodulestate *state = get_struct_state_structinst(self);
+    const char *fmt;
+    const formatdef *table;
+    formatcode *code;
+    PyObject *array_type, *columns;
+    Py_ssize_t nrecords, i = 0;
+    int swap;
+    static const char zeros[8] = {0};
+
+    assert(self->s_codes != NULL);
+
+    if (self->s_size == 0) {
+        PyErr_Format(state->StructError,
+                     "cannot unpack into columns with a struct of length 0");
+        return NULL;
+    }
+    if (buffer->len % self->s_size != 0) {
+        PyErr_Format(state->StructError,
+                     "unpacking into columns requires a buffer of "
+                     "a multiple of %zd bytes",
+                     self->s_size);
+        return NULL;
+    }
+    for (code = self->s_codes; code->fmtdef != NULL; code++) {
+        if (!column_typecode(code->fmtdef)) {
+            PyErr_Format(state->StructError,
+                         "cannot unpack format '%c' into an array",
+                         code->fmtdef->format);
+            return NULL;
+        }
+    }
+    nrecords = buffer->len / self->s_size;
+
+    /* The standard size tables store the bytes in a fixed order, which
+       the arrays must convert to the native one. */
+    fmt = PyBytes_AS_STRING(self->s_format);
+    table = whichtable(&fmt);
+#if PY_LITTLE_ENDIAN
+    swap = (table == bigendian_table);
+#else
+    swap = (table == lilendian_table);
+#endif
+
+    array_type = _PyImport_GetModuleAttrString("array", "array");
+    if (array_type == NULL)
+        return NULL;
+    columns = PyTuple_New(self->s_len);
+    if (columns == NULL)
+        goto fail;
+
+    for (code = self->s_codes; code->fmtdef != NULL; code++) {
+        int typecode = column_typecode(code->fmtdef);
+        const char *src = (const char *)buffer->buf + code->offset;
+        Py_ssize_t j;
+
+        for (j = 0; j < code->repeat; j++, src += code->size) {
+            PyObject *item, *column, *res;
+            Py_buffer view;
+
+            /* Give the array its final length by repeating a zero item,
+               then gather the field directly into the array's buffer. */
+            assert(code->size <= (Py_ssize_t)sizeof(zeros));
+            item = PyObject_CallFunction(array_type, "Cy#", typecode,
+                                         zeros, code->size);
+            if (item == NULL)
+                goto fail;
+            column = PySequence_Repeat(item, nrecords);
+            Py_DECREF(item);
+            if (column == NULL)
+                goto fail;
+            PyTuple_SET_ITEM(columns, i++, column);
+            if (PyObject_GetBuffer(column, &view, PyBUF_WRITABLE) < 0)
+                goto fail;
+            assert(view.len == nrecords * code->size);
+            gather_column(view.buf, src, code->size, self->s_size, nrecords);
+            PyBuffer_Release(&view);
+            if (swap && code->size > 1) {
+                res = PyObject_CallMethod(column, "byteswap", NULL);
+                if (res == NULL)
+                    goto fail;
+                Py_DECREF(res);
+            }
+        }
+    }
+    assert(i == self->s_len);
+    Py_DECREF(array_type);
+    return columns;
+
+fail:
+    Py_DECREF(array_type);
+    Py_XDECREF(columns);
+    return NULL;
+}
+
+
 /*
  * Guts of the pack function.
  *
@@ -2178,6 +2355,7 @@ static struct PyMethodDef s_methods[] = {
     {"pack_into",       _PyCFunction_CAST(s_pack_into), METH_FASTCALL, s_pack_into__doc__},
     STRUCT_UNPACK_METHODDEF
     STRUCT_UNPACK_FROM_METHODDEF
+    STRUCT_UNPACK_INTO_COLUMNS_METHODDEF
     {"__sizeof__",      (PyCFunction)s_sizeof, METH_NOARGS, s_sizeof__doc__},
     {NULL,       NULL}          /* sentinel */
 };
@@ -0,0 +1,999 @@
+/* Linux io_uring support for asyncio.uring_events */
+
+#ifndef Py_BUILD_CORE_BUILTIN
+#  define Py_BUILD_CORE_MODULE 1
+#endif
+
+#include "Python.h"
+#include "pycore_hashtable.h"     // _Py_hashtable_new()
+#include "pycore_moduleobject.h"  // _PyModule_GetState()
+
+#include <linux/io_uring.h>
+#include <signal.h>               // _NSIG
+#include <sys/mman.h>             // mmap()
+#include <sys/syscall.h>          // __NR_io_uring_setup
+#include <unistd.h>               // syscall()
+
+/* The kernel and this process share the ring indices: loads of indices
+   written by the kernel need acquire semantics and stores of indices read
+   by the kernel need release semantics. */
+#define load_acquire(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define store_release(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/* Features needed by Ring: a single mmap for both rings, no dropped
+   completions, and a timeout argument to io_uring_enter() (Linux 5.11). */
+#define REQUIRED_FEATURES \
+    (IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG)
+
+typedef struct {
+    PyTypeObject *RingType;
+} uring_state;
+
+static uring_state *
+get_uring_state(PyObject *module)
+{
+    uring_state *state = _PyModule_GetState(module);
+    assert(state != NULL);
+    return state;
+}
+
+static struct PyModuleDef uringmodule;
+#define get_uring_state_by_type(type) \
+    (get_uring_state(PyType_GetModuleByDef(type, &uringmodule)))
+
+/* An operation submitted to the kernel.  It owns the buffer exported by
+   the Python object until its completion has been reaped, since the kernel
+   reads or writes the memory until then.  Its id is both the user_data of
+   the submission and the number returned to Python: unlike the address
+   of the operation, it is never reused.  Id 0 marks the submissions whose
+   completions are not reported, such as cancellations. */
+typedef struct uring_op {
+    struct uring_op *prev;
+    struct uring_op *next;
+    uint64_t id;
+    Py_buffer view;
+} uring_op;
+
+typedef struct {
+    PyObject_HEAD
+    int fd;
+    /* Submission queue */
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_entries;
+    unsigned *sq_array;
+    struct io_uring_sqe *sqes;
+    unsigned to_submit;
+    /* Completion queue */
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+    /* Mappings */
+    void *ring_ptr;
+    size_t ring_size;
+    void *sqes_ptr;
+    size_t sqes_size;
+    /* Operations in flight (circular list in id order), and the same
+       operations by id */
+    uring_op ops;
+    _Py_hashtable_t *ops_by_id;
+    Py_ssize_t inflight;
+    uint64_t next_id;
+    /* Number of threads blocked in wait() */
+    int waiting;
+} RingObject;
+
+/*[clinic input]
+module _uring
+class _uring.Ring "RingObject *" "get_uring_state_by_type(type)->RingType"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=42236a9afbf99420]*/
+
+static int
+uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+            unsigned flags, struct __kernel_timespec *ts)
+{
+    struct io_uring_getevents_arg arg = {
+        .sigmask = 0,
+        .sigmask_sz = _NSIG / 8,
+        .ts = (uint64_t)(uintptr_t)ts,
+    };
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                        flags | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+}
+
+static PyObject *
+ring_err_closed(void)
+{
+    PyErr_SetString(PyExc_ValueError, "I/O operation on closed ring");
+    return NULL;
+}
+
+/* Hand the queued submissions to the kernel without waiting. */
+static int
+ring_flush(RingObject *self)
+{
+    while (self->to_submit > 0) {
+        int n = uring_enter(self->fd, self->to_submit, 0, 0, NULL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            /* EBUSY: the completion queue overflowed, the submissions stay
+               queued until the completions are reaped. */
+            if (errno == EBUSY || errno == EAGAIN) {
+                return 0;
+            }
+            PyErr_SetFromErrno(PyExc_OSError);
+            return -1;
+        }
+        self->to_submit -= n;
+    }
+    return 0;
+}
+
+static struct io_uring_sqe *
+ring_get_sqe(RingObject *self)
+{
+    unsigned tail = *self->sq_tail;
+    if (tail - load_acquire(self->sq_head) >= *self->sq_entries) {
+        if (ring_flush(self) < 0) {
+            return NULL;
+        }
+        if (tail - load_acquire(self->sq_head) >= *self->sq_entries) {
+            PyErr_SetString(PyExc_BlockingIOError,
+                            "io_uring submission queue is full");
+            return NULL;
+        }
+    }
+    unsigned index = tail & *self->sq_mask;
+    struct io_uring_sqe *sqe = &self->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    self->sq_array[index] = index;
+    return sqe;
+}
+
+static void
+ring_push_sqe(RingObject *self)
+{
+    store_release(self->sq_tail, *self->sq_tail + 1);
+    self->to_submit++;
+}
+
+/* The keys of ops_by_id point to the ids of the operations */
+static Py_uhash_t
+op_id_hash(const void *key)
+{
+    uint64_t id = *(const uint64_t *)key;
+    return (Py_uhash_t)(id ^ (id >> 32));
+}
+
+static int
+op_id_compare(const void *key1, const void *key2)
+{
+    return *(const uint64_t *)key1 == *(const uint64_t *)key2;
+}
+
+static uring_op *
+ring_find_op(RingObject *self, uint64_t id)
+{
+    return _Py_hashtable_get(self->ops_by_id, &id);
+}
+
+static uring_op *
+ring_new_op(RingObject *self)
+{
+    uring_op *op = PyMem_Malloc(sizeof(uring_op));
+    if (op == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    op->id = self->next_id++;
+    op->view.obj = NULL;
+    return op;
+}
+
+static void
+ring_free_op(uring_op *op)
+{
+    if (op->view.obj != NULL) {
+        PyBuffer_Release(&op->view);
+    }
+    PyMem_Free(op);
+}
+
+/* Forget a completed operation and release its buffer. */
+static void
+ring_complete_op(RingObject *self, uring_op *op)
+{
+    _Py_hashtable_steal(self->ops_by_id, &op->id);
+    op->prev->next = op->next;
+    op->next->prev = op->prev;
+    self->inflight--;
+    ring_free_op(op);
+}
+
+/* Queue an operation whose submission was filled in: from now on the
+   kernel owns its buffer. */
+static PyObject *
+ring_queue_op(RingObject *self, struct io_uring_sqe *sqe, uring_op *op)
+{
+    if (_Py_hashtable_set(self->ops_by_id, &op->id, op) < 0) {
+        /* The submission is overwritten by the next one */
+        ring_free_op(op);
+        return PyErr_NoMemory();
+    }
+    sqe->user_data = op->id;
+    op->next = &self->ops;
+    op->prev = self->ops.prev;
+    self->ops.prev->next = op;
+    self->ops.prev = op;
+    self->inflight++;
+    ring_push_sqe(self);
+    return PyLong_FromUnsignedLongLong(op->id);
+}
+
+/* Prepare an operation on a buffer.  Returns NULL with an exception set
+   on error. */
+static uring_op *
+ring_prep_buffer_op(RingObject *self, struct io_uring_sqe **psqe,
+                    int opcode, int fd, PyObject *buffer, int writable)
+{
+    if (self->fd < 0) {
+        ring_err_closed();
+        return NULL;
+    }
+    uring_op *op = ring_new_op(self);
+    if (op == NULL) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(buffer, &op->view,
+                           writable ? PyBUF_WRITABLE : PyBUF_SIMPLE) < 0) {
+        op->view.obj = NULL;
+        ring_free_op(op);
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        ring_free_op(op);
+        return NULL;
+    }
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)op->view.buf;
+    sqe->len = (unsigned)Py_MIN(op->view.len, (Py_ssize_t)UINT_MAX);
+    *psqe = sqe;
+    return op;
+}
+
+/* Cancel the operations and wait for all the completions.  Used when the
+   ring is closed: the buffers can only be released once the kernel is
+   done with them. */
+static void
+ring_drain(RingObject *self)
+{
+    /* The operations from id next on have no cancellation queued yet */
+    uint64_t next = 0;
+    while (self->inflight > 0) {
+        /* Queue as many cancellations as the submission queue holds: the
+           others are queued once the kernel consumed these */
+        for (uring_op *op = self->ops.next; op != &self->ops; op = op->next) {
+            if (op->id < next) {
+                continue;
+            }
+            unsigned tail = *self->sq_tail;
+            if (tail - load_acquire(self->sq_head) >= *self->sq_entries) {
+                break;
+            }
+            unsigned index = tail & *self->sq_mask;
+            struct io_uring_sqe *sqe = &self->sqes[index];
+            memset(sqe, 0, sizeof(*sqe));
+            self->sq_array[index] = index;
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->addr = op->id;
+            ring_push_sqe(self);
+            next = op->id + 1;
+        }
+
+        unsigned head = *self->cq_head;
+        unsigned tail = load_acquire(self->cq_tail);
+        for (; head != tail; head++) {
+            struct io_uring_cqe *cqe = &self->cqes[head & *self->cq_mask];
+            uring_op *op = ring_find_op(self, cqe->user_data);
+            if (op != NULL) {
+                ring_complete_op(self, op);
+            }
+        }
+        store_release(self->cq_head, head);
+        if (self->inflight == 0) {
+            break;
+        }
+        int res;
+        Py_BEGIN_ALLOW_THREADS
+        res = uring_enter(self->fd, self->to_submit, 1,
+                          IORING_ENTER_GETEVENTS, NULL);
+        Py_END_ALLOW_THREADS
+        if (res >= 0) {
+            self->to_submit -= res;
+        }
+        else if (errno != EINTR && errno != EBUSY && errno != EAGAIN) {
+            /* Leak the remaining buffers rather than letting the kernel
+               write into freed memory. */
+            break;
+        }
+    }
+}
+
+static void
+ring_internal_close(RingObject *self)
+{
+    if (self->fd < 0) {
+        return;
+    }
+    ring_drain(self);
+    if (self->sqes_ptr != NULL) {
+        munmap(self->sqes_ptr, self->sqes_size);
+        self->sqes_ptr = NULL;
+    }
+    if (self->ring_ptr != NULL) {
+        munmap(self->ring_ptr, self->ring_size);
+        self->ring_ptr = NULL;
+    }
+    int fd = self->fd;
+    self->fd = -1;
+    Py_BEGIN_ALLOW_THREADS
+    close(fd);
+    Py_END_ALLOW_THREADS
+}
+
+static int
+ring_setup(RingObject *self, unsigned entries)
+{
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    /* The completion queue is twice as large by default */
+    p.flags = IORING_SETUP_CLAMP;
+    int fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+    if (fd < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    /* The file descriptor is created with O_CLOEXEC */
+    self->fd = fd;
+    if ((p.features & REQUIRED_FEATURES) != REQUIRED_FEATURES) {
+        errno = EOPNOTSUPP;
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+
+    size_t sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    size_t cq_size = p.cq_off.cqes +
+                     p.cq_entries * sizeof(struct io_uring_cqe);
+    self->ring_size = Py_MAX(sq_size, cq_size);
+    void *ptr = mmap(NULL, self->ring_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (ptr == MAP_FAILED) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    self->ring_ptr = ptr;
+    self->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    ptr = mmap(NULL, self->sqes_size, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (ptr == MAP_FAILED) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    self->sqes_ptr = ptr;
+    self->sqes = ptr;
+
+    char *ring = self->ring_ptr;
+    self->sq_head = (unsigned *)(ring + p.sq_off.head);
+    self->sq_tail = (unsigned *)(ring + p.sq_off.tail);
+    self->sq_mask = (unsigned *)(ring + p.sq_off.ring_mask);
+    self->sq_entries = (unsigned *)(ring + p.sq_off.ring_entries);
+    self->sq_array = (unsigned *)(ring + p.sq_off.array);
+    self->cq_head = (unsigned *)(ring + p.cq_off.head);
+    self->cq_tail = (unsigned *)(ring + p.cq_off.tail);
+    self->cq_mask = (unsigned *)(ring + p.cq_off.ring_mask);
+    self->cqes = (struct io_uring_cqe *)(ring + p.cq_off.cqes);
+    return 0;
+}
+
+/*[clinic input]
+@classmethod
+_uring.Ring.__new__
+
+    entries: unsigned_int(bitwise=False) = 256
+        the size of the submission queue; it is rounded up to a power
+        of two, and the completion queue is twice as large
+
+Ring of submissions to and completions from the kernel.
+
+Raises OSError if the kernel has no io_uring support, or if it lacks
+the features needed here (Linux 5.11).
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_impl(PyTypeObject *type, unsigned int entries)
+/*[clinic end generated code: output=ec37bfaec3b9f3e6 input=d0dd0a60b551e48c]*/
+{
+    if (entries == 0) {
+        PyErr_SetString(PyExc_ValueError, "entries must be positive");
+        return NULL;
+    }
+    RingObject *self = (RingObject *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->fd = -1;
+    self->ops.prev = self->ops.next = &self->ops;
+    self->next_id = 1;
+    self->ops_by_id = _Py_hashtable_new(op_id_hash, op_id_compare);
+    if (self->ops_by_id == NULL) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    if (ring_setup(self, entries) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+static void
+ring_dealloc(RingObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+    ring_internal_close(self);
+    if (self->ops_by_id != NULL) {
+        _Py_hashtable_destroy(self->ops_by_id);
+    }
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+/* The only references are to the exporters of the buffers owned by the
+   kernel: they are released by close() or ring_dealloc() once the
+   operations completed, never by the garbage collector. */
+static int
+ring_clear(RingObject *self)
+{
+    return 0;
+}
+
+static int
+ring_traverse(RingObject *self, visitproc visit, void *arg)
+{
+    Py_VISIT(Py_TYPE(self));
+    for (uring_op *op = self->ops.next; op != &self->ops; op = op->next) {
+        Py_VISIT(op->view.obj);
+    }
+    return 0;
+}
+
+/*[clinic input]
+_uring.Ring.close
+
+Close the ring.
+
+Operations in flight are cancelled and waited for.  Raises RuntimeError
+if another thread is blocked in wait().
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_close_impl(RingObject *self)
+/*[clinic end generated code: output=447415269da3419f input=ace22c8dbea09326]*/
+{
+    if (self->waiting) {
+        /* The rings can't be unmapped under the waiting thread */
+        PyErr_SetString(PyExc_RuntimeError,
+                        "cannot close the ring while wait() is in progress");
+        return NULL;
+    }
+    ring_internal_close(self);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_uring.Ring.fileno
+
+Return the ring's file descriptor.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_fileno_impl(RingObject *self)
+/*[clinic end generated code: output=773263c5ad53ca3d input=ae8337ec4a51aed1]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    return PyLong_FromLong(self->fd);
+}
+
+/*[clinic input]
+_uring.Ring.recv
+
+    fd: int
+    buffer: object
+    flags: int
+    /
+
+Queue a recv() into a writable buffer.
+
+Returns the identifier of the operation.  The buffer is kept exported
+until the operation completes.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_recv_impl(RingObject *self, int fd, PyObject *buffer, int flags)
+/*[clinic end generated code: output=3996a7c690b04f1e input=03b88b6ab771651a]*/
+{
+    struct io_uring_sqe *sqe;
+    uring_op *op = ring_prep_buffer_op(self, &sqe, IORING_OP_RECV,
+                                       fd, buffer, 1);
+    if (op == NULL) {
+        return NULL;
+    }
+    sqe->msg_flags = (unsigned)flags;
+    return ring_queue_op(self, sqe, op);
+}
+
+/*[clinic input]
+_uring.Ring.send
+
+    fd: int
+    buffer: object
+    flags: int
+    /
+
+Queue a send() of a buffer.
+
+Returns the identifier of the operation.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_send_impl(RingObject *self, int fd, PyObject *buffer, int flags)
+/*[clinic end generated code: output=e87a1f408bb0170f input=09549bb41aaaa816]*/
+{
+    struct io_uring_sqe *sqe;
+    uring_op *op = ring_prep_buffer_op(self, &sqe, IORING_OP_SEND,
+                                       fd, buffer, 0);
+    if (op == NULL) {
+        return NULL;
+    }
+    sqe->msg_flags = (unsigned)flags;
+    return ring_queue_op(self, sqe, op);
+}
+
+/*[clinic input]
+_uring.Ring.read
+
+    fd: int
+    buffer: object
+    offset: long_long
+        the file offset, or -1 for the current file position
+    /
+
+Queue a read() or pread() into a writable buffer.
+
+Returns the identifier of the operation.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_read_impl(RingObject *self, int fd, PyObject *buffer,
+                      long long offset)
+/*[clinic end generated code: output=3e432c2f53cfef7c input=f96768f9d6e1d3d3]*/
+{
+    struct io_uring_sqe *sqe;
+    uring_op *op = ring_prep_buffer_op(self, &sqe, IORING_OP_READ,
+                                       fd, buffer, 1);
+    if (op == NULL) {
+        return NULL;
+    }
+    sqe->off = (uint64_t)offset;
+    return ring_queue_op(self, sqe, op);
+}
+
+/*[clinic input]
+_uring.Ring.write
+
+    fd: int
+    buffer: object
+    offset: long_long
+        the file offset, or -1 for the current file position
+    /
+
+Queue a write() or pwrite() of a buffer.
+
+Returns the identifier of the operation.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_write_impl(RingObject *self, int fd, PyObject *buffer,
+                       long long offset)
+/*[clinic end generated code: output=7e3bcd57b56bae09 input=c5c0a9b9bc14621b]*/
+{
+    struct io_uring_sqe *sqe;
+    uring_op *op = ring_prep_buffer_op(self, &sqe, IORING_OP_WRITE,
+                                       fd, buffer, 0);
+    if (op == NULL) {
+        return NULL;
+    }
+    sqe->off = (uint64_t)offset;
+    return ring_queue_op(self, sqe, op);
+}
+
+/*[clinic input]
+_uring.Ring.accept
+
+    fd: int
+    flags: int
+        flags of accept4(), such as SOCK_NONBLOCK | SOCK_CLOEXEC
+    /
+
+Queue an accept4() on a listening socket.
+
+The result of the operation is the file descriptor of the connection.
+Returns the identifier of the operation.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_accept_impl(RingObject *self, int fd, int flags)
+/*[clinic end generated code: output=a3c369f202fa044b input=312e49afc7f78bc5]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    uring_op *op = ring_new_op(self);
+    if (op == NULL) {
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        ring_free_op(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = fd;
+    sqe->accept_flags = (unsigned)flags;
+    return ring_queue_op(self, sqe, op);
+}
+
+/*[clinic input]
+_uring.Ring.poll
+
+    fd: int
+    events: unsigned_short(bitwise=True)
+        poll() events, such as select.POLLIN
+    /
+
+Queue a one-shot poll of a file descriptor.
+
+The result of the operation is the mask of the ready events.
+Returns the identifier of the operation.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_poll_impl(RingObject *self, int fd, unsigned short events)
+/*[clinic end generated code: output=e7533bc04fea1688 input=fda731f00ea5c563]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    uring_op *op = ring_new_op(self);
+    if (op == NULL) {
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        ring_free_op(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+#if PY_BIG_ENDIAN
+    /* The kernel reads the 32-bit field as two swapped 16-bit halves */
+    sqe->poll32_events = (uint32_t)events << 16;
+#else
+    sqe->poll32_events = events;
+#endif
+    return ring_queue_op(self, sqe, op);
+}
+
+/*[clinic input]
+_uring.Ring.cancel
+
+    id: unsigned_long_long(bitwise=False)
+    /
+
+Request the cancellation of an operation in flight.
+
+Its completion is still reported by wait(), with the result
+-errno.ECANCELED unless it completed first.  Returns False if the
+operation is not in flight.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_cancel_impl(RingObject *self, unsigned long long id)
+/*[clinic end generated code: output=6276dedd92a6a1ef input=50bc63944f7ef5c5]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    if (ring_find_op(self, id) == NULL) {
+        Py_RETURN_FALSE;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        return NULL;
+    }
+    /* The completion of the cancellation itself has id 0: wait() skips
+       it. */
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = id;
+    ring_push_sqe(self);
+    Py_RETURN_TRUE;
+}
+
+/*[clinic input]
+_uring.Ring.submit
+
+Hand the queued operations to the kernel without waiting.
+
+Returns the number of operations still queued.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_submit_impl(RingObject *self)
+/*[clinic end generated code: output=f8036e3d35cb13e9 input=4de3b34761924726]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    if (ring_flush(self) < 0) {
+        return NULL;
+    }
+    return PyLong_FromUnsignedLong(self->to_submit);
+}
+
+/* Append the (id, result) pairs of the available completions to list. */
+static int
+ring_reap(RingObject *self, PyObject *list)
+{
+    unsigned head = *self->cq_head;
+    unsigned tail = load_acquire(self->cq_tail);
+    int res = 0;
+    for (; head != tail; head++) {
+        struct io_uring_cqe *cqe = &self->cqes[head & *self->cq_mask];
+        uring_op *op = ring_find_op(self, cqe->user_data);
+        if (op == NULL) {
+            continue;
+        }
+        PyObject *item = Py_BuildValue("(Ki)", op->id, cqe->res);
+        if (item == NULL || PyList_Append(list, item) < 0) {
+            /* Keep the completion for the next call */
+            Py_XDECREF(item);
+            res = -1;
+            break;
+        }
+        Py_DECREF(item);
+        ring_complete_op(self, op);
+    }
+    store_release(self->cq_head, head);
+    return res;
+}
+
+/*[clinic input]
+_uring.Ring.wait
+
+    timeout as timeout_obj: object = None
+        the maximum time to wait for a completion in seconds (as float);
+        None waits indefinitely
+
+Submit the queued operations and wait for completions.
+
+Returns a list of (id, result) pairs, where result is what the system
+call would have returned, or -errno on error.  A single system call
+both submits and waits.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_wait_impl(RingObject *self, PyObject *timeout_obj)
+/*[clinic end generated code: output=480a97563d86ffbc input=fdfb8d8aacb34d16]*/
+{
+    struct __kernel_timespec ts, *pts = NULL;
+    unsigned min_complete = 1;
+
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    if (timeout_obj != Py_None) {
+        _PyTime_t timeout;
+        if (_PyTime_FromSecondsObject(&timeout, timeout_obj,
+                                      _PyTime_ROUND_TIMEOUT) < 0) {
+            return NULL;
+        }
+        if (timeout < 0) {
+            PyErr_SetString(PyExc_ValueError, "negative timeout");
+            return NULL;
+        }
+        if (timeout == 0) {
+            min_complete = 0;
+        }
+        else {
+            _PyTime_t ns = _PyTime_AsNanoseconds(timeout);
+            ts.tv_sec = ns / 1000000000;
+            ts.tv_nsec = ns % 1000000000;
+            pts = &ts;
+        }
+    }
+
+    PyObject *list = PyList_New(0);
+    if (list == NULL) {
+        return NULL;
+    }
+    if (*self->cq_head != load_acquire(self->cq_tail)) {
+        /* Completions are already available: don't wait for more. */
+        min_complete = 0;
+    }
+    if (self->to_submit > 0 || min_complete > 0) {
+        int n;
+        self->waiting++;
+        Py_BEGIN_ALLOW_THREADS
+        n = uring_enter(self->fd, self->to_submit, min_complete,
+                        min_complete ? IORING_ENTER_GETEVENTS : 0, pts);
+        Py_END_ALLOW_THREADS
+        self->waiting--;
+        if (n >= 0) {
+            self->to_submit -= n;
+        }
+        else if (errno == EINTR) {
+            if (PyErr_CheckSignals() < 0) {
+                Py_DECREF(list);
+                return NULL;
+            }
+        }
+        /* ETIME: timed out.  EBUSY: the completion queue overflowed,
+           reaping it below makes room. */
+        else if (errno != ETIME && errno != EBUSY && errno != EAGAIN) {
+            PyErr_SetFromErrno(PyExc_OSError);
+            Py_DECREF(list);
+            return NULL;
+        }
+    }
+    if (ring_reap(self, list) < 0) {
+        Py_DECREF(list);
+        return NULL;
+    }
+    return list;
+}
+
+static PyObject *
+ring_get_closed(RingObject *self, void *Py_UNUSED(ignored))
+{
+    return PyBool_FromLong(self->fd < 0);
+}
+
+static PyObject *
+ring_get_inflight(RingObject *self, void *Py_UNUSED(ignored))
+{
+    return PyLong_FromSsize_t(self->inflight);
+}
+
+#include "clinic/_uringmodule.c.h"
+
+static PyMethodDef ring_methods[] = {
+    _URING_RING_ACCEPT_METHODDEF
+    _URING_RING_CANCEL_METHODDEF
+    _URING_RING_CLOSE_METHODDEF
+    _URING_RING_FILENO_METHODDEF
+    _URING_RING_POLL_METHODDEF
+    _URING_RING_READ_METHODDEF
+    _URING_RING_RECV_METHODDEF
+    _URING_RING_SEND_METHODDEF
+    _URING_RING_SUBMIT_METHODDEF
+    _URING_RING_WAIT_METHODDEF
+    _URING_RING_WRITE_METHODDEF
+    {NULL, NULL}
+};
+
+static PyGetSetDef ring_getsetlist[] = {
+    {"closed", (getter)ring_get_closed, NULL,
+     "True if the ring is closed"},
+    {"inflight", (getter)ring_get_inflight, NULL,
+     "the number of operations whose completion was not reaped yet"},
+    {NULL, NULL, NULL, NULL},
+};
+
+static PyType_Slot ring_slots[] = {
+    {Py_tp_dealloc, ring_dealloc},
+    {Py_tp_doc, (void *)_uring_Ring__doc__},
+    {Py_tp_traverse, ring_traverse},
+    {Py_tp_clear, ring_clear},
+    {Py_tp_methods, ring_methods},
+    {Py_tp_getset, ring_getsetlist},
+    {Py_tp_new, _uring_Ring},
+    {0, NULL},
+};
+
+static PyType_Spec ring_spec = {
+    .name = "_uring.Ring",
+    .basicsize = sizeof(RingObject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+              Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = ring_slots,
+};
+
+
+/* Initialization function */
+
+PyDoc_STRVAR(uring_module_doc,
+"Linux io_uring support for asyncio.uring_events.\n\
+This module is an implementation detail, please do not use it directly.");
+
+static int
+uring_traverse(PyObject *module, visitproc visit, void *arg)
+{
+    uring_state *state = get_uring_state(module);
+    Py_VISIT(state->RingType);
+    return 0;
+}
+
+static int
+uring_clear(PyObject *module)
+{
+    uring_state *state = get_uring_state(module);
+    Py_CLEAR(state->RingType);
+    return 0;
+}
+
+static void
+uring_free(void *module)
+{
+    uring_clear((PyObject *)module);
+}
+
+static int
+uring_exec(PyObject *module)
+{
+    uring_state *state = get_uring_state(module);
+
+    state->RingType = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &ring_spec, NULL);
+    if (state->RingType == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->RingType) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static PyModuleDef_Slot uring_slots[] = {
+    {Py_mod_exec, uring_exec},
+    {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
+    {0, NULL}
+};
+
+static struct PyModuleDef uringmodule = {
+    .m_base = PyModuleDef_HEAD_INIT,
+    .m_name = "_uring",
+    .m_doc = uring_module_doc,
+    .m_size = sizeof(uring_state),
+    .m_slots = uring_slots,
+    .m_traverse = uring_traverse,
+    .m_clear = uring_clear,
+    .m_free = uring_free,
+};
+
+PyMODINIT_FUNC
+PyInit__uring(void)
+{
+    return PyModuleDef_Init(&uringmodule);
+}
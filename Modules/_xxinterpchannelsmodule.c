@@ -169,6 +169,8 @@ add_new_type(PyObject *mod, PyType_Spec *spec, crossinterpdatafunc shared)
 #define XID_IGNORE_EXC 1
 #define XID_FREE 2
 
+static void _uncount_shared_buffer(_PyCrossInterpreterData *);
+
 static int
 _release_xid_data(_PyCrossInterpreterData *data, int flags)
 {
@@ -177,6 +179,7 @@ _release_xid_data(_PyCrossInterpreterData *data, int flags)
     if (ignoreexc) {
         exc = PyErr_GetRaisedException();
     }
+    _uncount_shared_buffer(data);
     int res;
     if (flags & XID_FREE) {
         res = _PyCrossInterpreterData_ReleaseAndRawFree(data);
@@ -206,6 +209,7 @@ _release_xid_data(_PyCrossInterpreterData *data, int flags)
 typedef struct {
     /* heap types */
     PyTypeObject *ChannelIDType;
+    PyTypeObject *XIBufferViewType;
 
     /* exceptions */
     PyObject *ChannelError;
@@ -229,6 +233,7 @@ traverse_module_state(module_state *state, visitproc visit, void *arg)
 {
     /* heap types */
     Py_VISIT(state->ChannelIDType);
+    Py_VISIT(state->XIBufferViewType);
 
     /* exceptions */
     Py_VISIT(state->ChannelError);
@@ -248,6 +253,10 @@ clear_module_state(module_state *state)
         (void)_PyCrossInterpreterData_UnregisterClass(state->ChannelIDType);
     }
     Py_CLEAR(state->ChannelIDType);
+    if (state->XIBufferViewType != NULL) {
+        (void)_PyCrossInterpreterData_UnregisterClass(&PyMemoryView_Type);
+    }
+    Py_CLEAR(state->XIBufferViewType);
 
     /* exceptions */
     Py_CLEAR(state->ChannelError);
@@ -1949,6 +1958,184 @@ static PyType_Spec ChannelIDType_spec = {
 };
 
 
+/* buffer-backed cross-interpreter data *************************************/
+
+/* A memoryview is shared by reference rather than copied.  The sending
+   interpreter keeps the buffer exported (via a Py_buffer it owns) until
+   the receiving interpreter is done with it, at which point the buffer
+   is released back in the owning interpreter.  That means the sending
+   interpreter must outlive any memoryview received from it: until the
+   release is requested, the buffer is counted in the interpreter's
+   shared_buffers and _xxsubinterpreters.destroy() refuses to destroy it. */
+
+typedef struct {
+    Py_buffer view;
+    /* Still counted in the exporting interpreter's shared_buffers. */
+    int counted;
+} _sharedbuffer;
+
+typedef struct {
+    PyObject_HEAD
+    Py_buffer *view;
+    _PyCrossInterpreterData *data;
+} XIBufferViewObject;
+
+static PyObject *
+xibufferview_from_xid(PyTypeObject *cls, _PyCrossInterpreterData *data)
+{
+    assert(data->data != NULL);
+    assert(data->obj == NULL);
+    assert(data->interp >= 0);
+    XIBufferViewObject *self = PyObject_New(XIBufferViewObject, cls);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->view = NULL;
+    self->data = NULL;
+    /* Take ownership of the shared buffer.  The channel frees its own
+       copy of the XID data after this, so we make one that outlives it
+       and leave nothing behind for the channel to release. */
+    _PyCrossInterpreterData *copied = GLOBAL_MALLOC(_PyCrossInterpreterData);
+    if (copied == NULL) {
+        Py_DECREF(self);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    *copied = *data;
+    data->data = NULL;
+    self->view = &((_sharedbuffer *)copied->data)->view;
+    self->data = copied;
+    return (PyObject *)self;
+}
+
+static void
+xibufferview_dealloc(XIBufferViewObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    if (self->data != NULL) {
+        /* The buffer is released in the interpreter that exported it. */
+        (void)_release_xid_data(self->data, XID_IGNORE_EXC | XID_FREE);
+    }
+    tp->tp_free(self);
+    /* "Instances of heap-allocated types hold a reference to their type."
+       See: https://docs.python.org/3.11/howto/isolating-extensions.html#garbage-collection-protocol
+       See: https://docs.python.org/3.11/c-api/typeobj.html#c.PyTypeObject.tp_traverse
+    */
+    // XXX Why don't we implement Py_TPFLAGS_HAVE_GC, e.g. Py_tp_traverse,
+    // like we do for _abc._abc_data?
+    Py_DECREF(tp);
+}
+
+static int
+xibufferview_getbuf(XIBufferViewObject *self, Py_buffer *view, int flags)
+{
+    /* Only PyMemoryView_FromObject() should ever call this,
+       via _memoryview_from_xid(). */
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError,
+                        "buffers shared between interpreters are read-only");
+        return -1;
+    }
+    *view = *self->view;
+    view->obj = Py_NewRef(self);
+    view->readonly = 1;
+    view->internal = NULL;
+    return 0;
+}
+
+static PyType_Slot XIBufferViewType_slots[] = {
+    {Py_tp_dealloc, (destructor)xibufferview_dealloc},
+    {Py_bf_getbuffer, (getbufferproc)xibufferview_getbuf},
+    // We don't bother with Py_bf_releasebuffer since we don't need it.
+    {0, NULL},
+};
+
+static PyType_Spec XIBufferViewType_spec = {
+    .name = MODULE_NAME ".CrossInterpreterBufferView",
+    .basicsize = sizeof(XIBufferViewObject),
+    .flags = (Py_TPFLAGS_DEFAULT |
+              Py_TPFLAGS_DISALLOW_INSTANTIATION | Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = XIBufferViewType_slots,
+};
+
+static PyObject *
+_memoryview_from_xid(_PyCrossInterpreterData *data)
+{
+    // It might not be imported yet, so we can't use _get_current_module().
+    PyObject *mod = PyImport_ImportModule(MODULE_NAME);
+    if (mod == NULL) {
+        return NULL;
+    }
+    module_state *state = get_module_state(mod);
+    PyObject *obj = xibufferview_from_xid(state->XIBufferViewType, data);
+    Py_DECREF(mod);
+    if (obj == NULL) {
+        return NULL;
+    }
+    PyObject *res = PyMemoryView_FromObject(obj);
+    Py_DECREF(obj);
+    return res;
+}
+
+/* Called when the release of a shared buffer is requested, possibly from
+   another interpreter: once it is queued, destroying the exporting
+   interpreter releases it first. */
+static void
+_uncount_shared_buffer(_PyCrossInterpreterData *data)
+{
+    if (data->new_object != _memoryview_from_xid || data->data == NULL) {
+        return;
+    }
+    _sharedbuffer *shared = (_sharedbuffer *)data->data;
+    if (!shared->counted) {
+        return;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_LookUpID(data->interp);
+    if (interp == NULL) {
+        /* The owning interpreter is already destroyed. */
+        PyErr_Clear();
+        return;
+    }
+    _PyInterpreterState_AddSharedBuffers(interp, -1);
+    shared->counted = 0;
+}
+
+static void
+_release_shared_buffer(void *data)
+{
+    _sharedbuffer *shared = (_sharedbuffer *)data;
+    if (shared->counted) {
+        /* Released without going through _release_xid_data(). */
+        _PyInterpreterState_AddSharedBuffers(_PyInterpreterState_GET(), -1);
+    }
+    PyBuffer_Release(&shared->view);
+    GLOBAL_FREE(shared);
+}
+
+static int
+_memoryview_shared(PyThreadState *tstate, PyObject *obj,
+                   _PyCrossInterpreterData *data)
+{
+    _sharedbuffer *shared = GLOBAL_MALLOC(_sharedbuffer);
+    if (shared == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (PyObject_GetBuffer(obj, &shared->view, PyBUF_FULL_RO) < 0) {
+        GLOBAL_FREE(shared);
+        return -1;
+    }
+    shared->counted = 1;
+    _PyInterpreterState_AddSharedBuffers(tstate->interp, 1);
+    /* The exported buffer holds a reference to its object, so there is
+       no need to set data->obj. */
+    _PyCrossInterpreterData_Init(data, tstate->interp, shared, NULL,
+                                 _memoryview_from_xid);
+    data->free = _release_shared_buffer;
+    return 0;
+}
+
+
 /* module level code ********************************************************/
 
 /* globals is the process-global state for the module.  It holds all
@@ -2207,7 +2394,11 @@ channel_send(PyObject *self, PyObject *args, PyObject *kwds)
 PyDoc_STRVAR(channel_send_doc,
 "channel_send(cid, obj)\n\
 \n\
-Add the object's data to the channel's queue.");
+Add the object's data to the channel's queue.\n\
+\n\
+A memoryview is not copied: the receiver gets a read-only view of the\n\
+same memory.  Until that view is released (or the object is dropped\n\
+from the channel), the sending interpreter cannot be destroyed.");
 
 static PyObject *
 channel_recv(PyObject *self, PyObject *args, PyObject *kwds)
@@ -2416,6 +2607,19 @@ module_exec(PyObject *mod)
         goto error;
     }
 
+    // memoryview
+    state->XIBufferViewType = (PyTypeObject *)PyType_FromModuleAndSpec(
+            mod, &XIBufferViewType_spec, NULL);
+    if (state->XIBufferViewType == NULL) {
+        goto error;
+    }
+    if (_PyCrossInterpreterData_RegisterClass(
+            &PyMemoryView_Type, _memoryview_shared) < 0)
+    {
+        Py_CLEAR(state->XIBufferViewType);
+        goto error;
+    }
+
     // Make sure chnnels drop objects owned by this interpreter
     PyInterpreterState *interp = _get_current_interp();
     _Py_AtExit(interp, clear_interpreter, (void *)interp);
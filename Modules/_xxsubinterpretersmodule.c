@@ -573,6 +573,14 @@ interp_destroy(PyObject *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
+    // Ensure no other interpreter still reads from its memory.
+    if (_PyInterpreterState_HasSharedBuffers(interp)) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "interpreter has buffers shared with other "
+                        "interpreters");
+        return NULL;
+    }
+
     // Destroy the interpreter.
     // XXX gh-109860: Using the "head" thread isn't strictly correct.
     PyThreadState *tstate = PyInterpreterState_ThreadHead(interp);
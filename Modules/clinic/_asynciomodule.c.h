@@ -1428,6 +1428,124 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_asyncio__run_ready__doc__,
+"_run_ready($module, ready, ntodo, /)\n"
+"--\n"
+"\n"
+"Run the first ntodo handles of the ready queue of an event loop.\n"
+"\n"
+"Cancelled handles are skipped.");
+
+#define _ASYNCIO__RUN_READY_METHODDEF    \
+    {"_run_ready", _PyCFunction_CAST(_asyncio__run_ready), METH_FASTCALL, _asyncio__run_ready__doc__},
+
+static PyObject *
+_asyncio__run_ready_impl(PyObject *module, PyObject *ready, Py_ssize_t ntodo);
+
+static PyObject *
+_asyncio__run_ready(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *ready;
+    Py_ssize_t ntodo;
+
+    if (!_PyArg_CheckPositional("_run_ready", nargs, 2, 2)) {
+        goto exit;
+    }
+    ready = args[0];
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        ntodo = ival;
+    }
+    return_value = _asyncio__run_ready_impl(module, ready, ntodo);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__pop_due_timers__doc__,
+"_pop_due_timers($module, scheduled, ready, end_time, /)\n"
+"--\n"
+"\n"
+"Move the timer handles due before end_time to the ready queue.\n"
+"\n"
+"The handles are popped from the scheduled heap in order.");
+
+#define _ASYNCIO__POP_DUE_TIMERS_METHODDEF    \
+    {"_pop_due_timers", _PyCFunction_CAST(_asyncio__pop_due_timers), METH_FASTCALL, _asyncio__pop_due_timers__doc__},
+
+static PyObject *
+_asyncio__pop_due_timers_impl(PyObject *module, PyObject *scheduled,
+                              PyObject *ready, PyObject *end_time);
+
+static PyObject *
+_asyncio__pop_due_timers(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *scheduled;
+    PyObject *ready;
+    PyObject *end_time;
+
+    if (!_PyArg_CheckPositional("_pop_due_timers", nargs, 3, 3)) {
+        goto exit;
+    }
+    if (!PyList_Check(args[0])) {
+        _PyArg_BadArgument("_pop_due_timers", "argument 1", "list", args[0]);
+        goto exit;
+    }
+    scheduled = args[0];
+    ready = args[1];
+    end_time = args[2];
+    return_value = _asyncio__pop_due_timers_impl(module, scheduled, ready, end_time);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__process_selector_events__doc__,
+"_process_selector_events($module, loop, ready, event_list, /)\n"
+"--\n"
+"\n"
+"Add the handles for the (key, mask) pairs of event_list to the ready queue.\n"
+"\n"
+"This is what BaseSelectorEventLoop._process_events() does, for loops\n"
+"whose _add_callback() method is not overridden.");
+
+#define _ASYNCIO__PROCESS_SELECTOR_EVENTS_METHODDEF    \
+    {"_process_selector_events", _PyCFunction_CAST(_asyncio__process_selector_events), METH_FASTCALL, _asyncio__process_selector_events__doc__},
+
+static PyObject *
+_asyncio__process_selector_events_impl(PyObject *module, PyObject *loop,
+                                       PyObject *ready, PyObject *event_list);
+
+static PyObject *
+_asyncio__process_selector_events(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *loop;
+    PyObject *ready;
+    PyObject *event_list;
+
+    if (!_PyArg_CheckPositional("_process_selector_events", nargs, 3, 3)) {
+        goto exit;
+    }
+    loop = args[0];
+    ready = args[1];
+    event_list = args[2];
+    return_value = _asyncio__process_selector_events_impl(module, loop, ready, event_list);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(_asyncio_current_task__doc__,
 "current_task($module, /, loop=None)\n"
 "--\n"
@@ -1487,4 +1605,4 @@ skip_optional_pos:
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=127ba6153250d769 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=245bea9145a205e7 input=a9049054013a1b77]*/
@@ -171,6 +171,18 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_queue_SimpleQueue_put_many__doc__,
+"put_many($self, items, /)\n"
+"--\n"
+"\n"
+"Put all the items of an iterable on the queue, in order.\n"
+"\n"
+"The items are added at once: a concurrent get() sees either none or\n"
+"all of them.  This method never blocks.");
+
+#define _QUEUE_SIMPLEQUEUE_PUT_MANY_METHODDEF    \
+    {"put_many", (PyCFunction)_queue_SimpleQueue_put_many, METH_O, _queue_SimpleQueue_put_many__doc__},
+
 PyDoc_STRVAR(_queue_SimpleQueue_get__doc__,
 "get($self, /, block=True, timeout=None)\n"
 "--\n"
@@ -250,6 +262,94 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_queue_SimpleQueue_get_many__doc__,
+"get_many($self, max_items, /, block=True, timeout=None)\n"
+"--\n"
+"\n"
+"Remove and return a list of up to \'max_items\' items from the queue.\n"
+"\n"
+"Wait for the first item like get() does, then also take whichever\n"
+"other items are immediately available, up to \'max_items\' in total.");
+
+#define _QUEUE_SIMPLEQUEUE_GET_MANY_METHODDEF    \
+    {"get_many", _PyCFunction_CAST(_queue_SimpleQueue_get_many), METH_METHOD|METH_FASTCALL|METH_KEYWORDS, _queue_SimpleQueue_get_many__doc__},
+
+static PyObject *
+_queue_SimpleQueue_get_many_impl(simplequeueobject *self, PyTypeObject *cls,
+                                 Py_ssize_t max_items, int block,
+                                 PyObject *timeout_obj);
+
+static PyObject *
+_queue_SimpleQueue_get_many(simplequeueobject *self, PyTypeObject *cls, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(block), &_Py_ID(timeout), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"", "block", "timeout", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "get_many",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[3];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    Py_ssize_t max_items;
+    int block = 1;
+    PyObject *timeout_obj = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 3, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[0]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        max_items = ival;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[1]) {
+        block = PyObject_IsTrue(args[1]);
+        if (block < 0) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    timeout_obj = args[2];
+skip_optional_pos:
+    return_value = _queue_SimpleQueue_get_many_impl(self, cls, max_items, block, timeout_obj);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(_queue_SimpleQueue_get_nowait__doc__,
 "get_nowait($self, /)\n"
 "--\n"
@@ -331,4 +431,4 @@ _queue_SimpleQueue_qsize(simplequeueobject *self, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=78816f171ecc4422 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=84c514335189b195 input=a9049054013a1b77]*/
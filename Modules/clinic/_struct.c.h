@@ -214,6 +214,49 @@ PyDoc_STRVAR(Struct_iter_unpack__doc__,
 #define STRUCT_ITER_UNPACK_METHODDEF    \
     {"iter_unpack", (PyCFunction)Struct_iter_unpack, METH_O, Struct_iter_unpack__doc__},
 
+PyDoc_STRVAR(Struct_unpack_into_columns__doc__,
+"unpack_into_columns($self, buffer, /)\n"
+"--\n"
+"\n"
+"Return a tuple of array.array objects, one per unpacked field.\n"
+"\n"
+"The i-th array holds the i-th field of every record in the buffer, as\n"
+"if each record had been unpacked with unpack_from(), but without\n"
+"creating a tuple per record.  Only integer and float formats are\n"
+"supported.\n"
+"\n"
+"Requires that the bytes length be a multiple of the struct size.");
+
+#define STRUCT_UNPACK_INTO_COLUMNS_METHODDEF    \
+    {"unpack_into_columns", (PyCFunction)Struct_unpack_into_columns, METH_O, Struct_unpack_into_columns__doc__},
+
+static PyObject *
+Struct_unpack_into_columns_impl(PyStructObject *self, Py_buffer *buffer);
+
+static PyObject *
+Struct_unpack_into_columns(PyStructObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+
+    if (PyObject_GetBuffer(arg, &buffer, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("unpack_into_columns", "argument", "contiguous buffer", arg);
+        goto exit;
+    }
+    return_value = Struct_unpack_into_columns_impl(self, &buffer);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_clearcache__doc__,
 "_clearcache($module, /)\n"
 "--\n"
@@ -451,4 +494,4 @@ exit:
 
     return return_value;
 }
-/*[clinic end generated code: output=eca7df0e75f8919d input=a9049054013a1b77]*/
+/*[clinic end generated code: output=25f310b1ac08a368 input=a9049054013a1b77]*/
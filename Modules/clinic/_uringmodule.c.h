@@ -0,0 +1,489 @@
+/*[clinic input]
+preserve
+[clinic start generated code]*/
+
+#if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+#  include "pycore_gc.h"            // PyGC_Head
+#  include "pycore_runtime.h"       // _Py_ID()
+#endif
+
+
+PyDoc_STRVAR(_uring_Ring__doc__,
+"Ring(entries=256)\n"
+"--\n"
+"\n"
+"Ring of submissions to and completions from the kernel.\n"
+"\n"
+"  entries\n"
+"    the size of the submission queue; it is rounded up to a power\n"
+"    of two, and the completion queue is twice as large\n"
+"\n"
+"Raises OSError if the kernel has no io_uring support, or if it lacks\n"
+"the features needed here (Linux 5.11).");
+
+static PyObject *
+_uring_Ring_impl(PyTypeObject *type, unsigned int entries);
+
+static PyObject *
+_uring_Ring(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(entries), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"entries", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "Ring",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 0;
+    unsigned int entries = 256;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 0, 1, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (!_PyLong_UnsignedInt_Converter(fastargs[0], &entries)) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = _uring_Ring_impl(type, entries);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_close__doc__,
+"close($self, /)\n"
+"--\n"
+"\n"
+"Close the ring.\n"
+"\n"
+"Operations in flight are cancelled and waited for.  Raises RuntimeError\n"
+"if another thread is blocked in wait().");
+
+#define _URING_RING_CLOSE_METHODDEF    \
+    {"close", (PyCFunction)_uring_Ring_close, METH_NOARGS, _uring_Ring_close__doc__},
+
+static PyObject *
+_uring_Ring_close_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_close(RingObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _uring_Ring_close_impl(self);
+}
+
+PyDoc_STRVAR(_uring_Ring_fileno__doc__,
+"fileno($self, /)\n"
+"--\n"
+"\n"
+"Return the ring\'s file descriptor.");
+
+#define _URING_RING_FILENO_METHODDEF    \
+    {"fileno", (PyCFunction)_uring_Ring_fileno, METH_NOARGS, _uring_Ring_fileno__doc__},
+
+static PyObject *
+_uring_Ring_fileno_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_fileno(RingObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _uring_Ring_fileno_impl(self);
+}
+
+PyDoc_STRVAR(_uring_Ring_recv__doc__,
+"recv($self, fd, buffer, flags, /)\n"
+"--\n"
+"\n"
+"Queue a recv() into a writable buffer.\n"
+"\n"
+"Returns the identifier of the operation.  The buffer is kept exported\n"
+"until the operation completes.");
+
+#define _URING_RING_RECV_METHODDEF    \
+    {"recv", _PyCFunction_CAST(_uring_Ring_recv), METH_FASTCALL, _uring_Ring_recv__doc__},
+
+static PyObject *
+_uring_Ring_recv_impl(RingObject *self, int fd, PyObject *buffer, int flags);
+
+static PyObject *
+_uring_Ring_recv(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    PyObject *buffer;
+    int flags;
+
+    if (!_PyArg_CheckPositional("recv", nargs, 3, 3)) {
+        goto exit;
+    }
+    fd = _PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    buffer = args[1];
+    flags = _PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _uring_Ring_recv_impl(self, fd, buffer, flags);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_send__doc__,
+"send($self, fd, buffer, flags, /)\n"
+"--\n"
+"\n"
+"Queue a send() of a buffer.\n"
+"\n"
+"Returns the identifier of the operation.");
+
+#define _URING_RING_SEND_METHODDEF    \
+    {"send", _PyCFunction_CAST(_uring_Ring_send), METH_FASTCALL, _uring_Ring_send__doc__},
+
+static PyObject *
+_uring_Ring_send_impl(RingObject *self, int fd, PyObject *buffer, int flags);
+
+static PyObject *
+_uring_Ring_send(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    PyObject *buffer;
+    int flags;
+
+    if (!_PyArg_CheckPositional("send", nargs, 3, 3)) {
+        goto exit;
+    }
+    fd = _PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    buffer = args[1];
+    flags = _PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _uring_Ring_send_impl(self, fd, buffer, flags);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_read__doc__,
+"read($self, fd, buffer, offset, /)\n"
+"--\n"
+"\n"
+"Queue a read() or pread() into a writable buffer.\n"
+"\n"
+"  offset\n"
+"    the file offset, or -1 for the current file position\n"
+"\n"
+"Returns the identifier of the operation.");
+
+#define _URING_RING_READ_METHODDEF    \
+    {"read", _PyCFunction_CAST(_uring_Ring_read), METH_FASTCALL, _uring_Ring_read__doc__},
+
+static PyObject *
+_uring_Ring_read_impl(RingObject *self, int fd, PyObject *buffer,
+                      long long offset);
+
+static PyObject *
+_uring_Ring_read(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    PyObject *buffer;
+    long long offset;
+
+    if (!_PyArg_CheckPositional("read", nargs, 3, 3)) {
+        goto exit;
+    }
+    fd = _PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    buffer = args[1];
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _uring_Ring_read_impl(self, fd, buffer, offset);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_write__doc__,
+"write($self, fd, buffer, offset, /)\n"
+"--\n"
+"\n"
+"Queue a write() or pwrite() of a buffer.\n"
+"\n"
+"  offset\n"
+"    the file offset, or -1 for the current file position\n"
+"\n"
+"Returns the identifier of the operation.");
+
+#define _URING_RING_WRITE_METHODDEF    \
+    {"write", _PyCFunction_CAST(_uring_Ring_write), METH_FASTCALL, _uring_Ring_write__doc__},
+
+static PyObject *
+_uring_Ring_write_impl(RingObject *self, int fd, PyObject *buffer,
+                       long long offset);
+
+static PyObject *
+_uring_Ring_write(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    PyObject *buffer;
+    long long offset;
+
+    if (!_PyArg_CheckPositional("write", nargs, 3, 3)) {
+        goto exit;
+    }
+    fd = _PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    buffer = args[1];
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _uring_Ring_write_impl(self, fd, buffer, offset);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_accept__doc__,
+"accept($self, fd, flags, /)\n"
+"--\n"
+"\n"
+"Queue an accept4() on a listening socket.\n"
+"\n"
+"  flags\n"
+"    flags of accept4(), such as SOCK_NONBLOCK | SOCK_CLOEXEC\n"
+"\n"
+"The result of the operation is the file descriptor of the connection.\n"
+"Returns the identifier of the operation.");
+
+#define _URING_RING_ACCEPT_METHODDEF    \
+    {"accept", _PyCFunction_CAST(_uring_Ring_accept), METH_FASTCALL, _uring_Ring_accept__doc__},
+
+static PyObject *
+_uring_Ring_accept_impl(RingObject *self, int fd, int flags);
+
+static PyObject *
+_uring_Ring_accept(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    int flags;
+
+    if (!_PyArg_CheckPositional("accept", nargs, 2, 2)) {
+        goto exit;
+    }
+    fd = _PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    flags = _PyLong_AsInt(args[1]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _uring_Ring_accept_impl(self, fd, flags);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_poll__doc__,
+"poll($self, fd, events, /)\n"
+"--\n"
+"\n"
+"Queue a one-shot poll of a file descriptor.\n"
+"\n"
+"  events\n"
+"    poll() events, such as select.POLLIN\n"
+"\n"
+"The result of the operation is the mask of the ready events.\n"
+"Returns the identifier of the operation.");
+
+#define _URING_RING_POLL_METHODDEF    \
+    {"poll", _PyCFunction_CAST(_uring_Ring_poll), METH_FASTCALL, _uring_Ring_poll__doc__},
+
+static PyObject *
+_uring_Ring_poll_impl(RingObject *self, int fd, unsigned short events);
+
+static PyObject *
+_uring_Ring_poll(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    unsigned short events;
+
+    if (!_PyArg_CheckPositional("poll", nargs, 2, 2)) {
+        goto exit;
+    }
+    fd = _PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    events = (unsigned short)PyLong_AsUnsignedLongMask(args[1]);
+    if (events == (unsigned short)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _uring_Ring_poll_impl(self, fd, events);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_cancel__doc__,
+"cancel($self, id, /)\n"
+"--\n"
+"\n"
+"Request the cancellation of an operation in flight.\n"
+"\n"
+"Its completion is still reported by wait(), with the result\n"
+"-errno.ECANCELED unless it completed first.  Returns False if the\n"
+"operation is not in flight.");
+
+#define _URING_RING_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_uring_Ring_cancel, METH_O, _uring_Ring_cancel__doc__},
+
+static PyObject *
+_uring_Ring_cancel_impl(RingObject *self, unsigned long long id);
+
+static PyObject *
+_uring_Ring_cancel(RingObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    unsigned long long id;
+
+    if (!_PyLong_UnsignedLongLong_Converter(arg, &id)) {
+        goto exit;
+    }
+    return_value = _uring_Ring_cancel_impl(self, id);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_submit__doc__,
+"submit($self, /)\n"
+"--\n"
+"\n"
+"Hand the queued operations to the kernel without waiting.\n"
+"\n"
+"Returns the number of operations still queued.");
+
+#define _URING_RING_SUBMIT_METHODDEF    \
+    {"submit", (PyCFunction)_uring_Ring_submit, METH_NOARGS, _uring_Ring_submit__doc__},
+
+static PyObject *
+_uring_Ring_submit_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_submit(RingObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _uring_Ring_submit_impl(self);
+}
+
+PyDoc_STRVAR(_uring_Ring_wait__doc__,
+"wait($self, /, timeout=None)\n"
+"--\n"
+"\n"
+"Submit the queued operations and wait for completions.\n"
+"\n"
+"  timeout\n"
+"    the maximum time to wait for a completion in seconds (as float);\n"
+"    None waits indefinitely\n"
+"\n"
+"Returns a list of (id, result) pairs, where result is what the system\n"
+"call would have returned, or -errno on error.  A single system call\n"
+"both submits and waits.");
+
+#define _URING_RING_WAIT_METHODDEF    \
+    {"wait", _PyCFunction_CAST(_uring_Ring_wait), METH_FASTCALL|METH_KEYWORDS, _uring_Ring_wait__doc__},
+
+static PyObject *
+_uring_Ring_wait_impl(RingObject *self, PyObject *timeout_obj);
+
+static PyObject *
+_uring_Ring_wait(RingObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(timeout), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"timeout", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "wait",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    PyObject *timeout_obj = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 0, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    timeout_obj = args[0];
+skip_optional_pos:
+    return_value = _uring_Ring_wait_impl(self, timeout_obj);
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=824eda05e57aa39f input=a9049054013a1b77]*/
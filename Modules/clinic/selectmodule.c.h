@@ -969,6 +969,83 @@ exit:
 
 #if defined(HAVE_EPOLL)
 
+PyDoc_STRVAR(select_epoll_poll_into__doc__,
+"poll_into($self, /, buffer, timeout=None)\n"
+"--\n"
+"\n"
+"Wait for events on the epoll file descriptor, storing them into buffer.\n"
+"\n"
+"  buffer\n"
+"    a writable buffer of unsigned 64-bit integers, such as array(\'Q\')\n"
+"  timeout\n"
+"    the maximum time to wait in seconds (as float);\n"
+"    a timeout of None or -1 makes poll wait indefinitely\n"
+"\n"
+"Each event is stored as two consecutive integers, the descriptor and\n"
+"its events, so at most len(buffer) // 2 events are reported.\n"
+"Returns the number of events stored.");
+
+#define SELECT_EPOLL_POLL_INTO_METHODDEF    \
+    {"poll_into", _PyCFunction_CAST(select_epoll_poll_into), METH_FASTCALL|METH_KEYWORDS, select_epoll_poll_into__doc__},
+
+static PyObject *
+select_epoll_poll_into_impl(pyEpoll_Object *self, PyObject *buffer_obj,
+                            PyObject *timeout_obj);
+
+static PyObject *
+select_epoll_poll_into(pyEpoll_Object *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(buffer), &_Py_ID(timeout), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"buffer", "timeout", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "poll_into",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    PyObject *buffer_obj;
+    PyObject *timeout_obj = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 2, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    buffer_obj = args[0];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    timeout_obj = args[1];
+skip_optional_pos:
+    return_value = select_epoll_poll_into_impl(self, buffer_obj, timeout_obj);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_EPOLL) */
+
+#if defined(HAVE_EPOLL)
+
 PyDoc_STRVAR(select_epoll___enter____doc__,
 "__enter__($self, /)\n"
 "--\n"
@@ -1286,6 +1363,10 @@ exit:
     #define SELECT_EPOLL_POLL_METHODDEF
 #endif /* !defined(SELECT_EPOLL_POLL_METHODDEF) */
 
+#ifndef SELECT_EPOLL_POLL_INTO_METHODDEF
+    #define SELECT_EPOLL_POLL_INTO_METHODDEF
+#endif /* !defined(SELECT_EPOLL_POLL_INTO_METHODDEF) */
+
 #ifndef SELECT_EPOLL___ENTER___METHODDEF
     #define SELECT_EPOLL___ENTER___METHODDEF
 #endif /* !defined(SELECT_EPOLL___ENTER___METHODDEF) */
@@ -1309,4 +1390,4 @@ exit:
 #ifndef SELECT_KQUEUE_CONTROL_METHODDEF
     #define SELECT_KQUEUE_CONTROL_METHODDEF
 #endif /* !defined(SELECT_KQUEUE_CONTROL_METHODDEF) */
-/*[clinic end generated code: output=64516114287e894d input=a9049054013a1b77]*/
+/*[clinic end generated code: output=3693afb68cea4d68 input=a9049054013a1b77]*/
@@ -1054,6 +1054,7 @@ clear_freelists(PyInterpreterState *interp)
     _PyFloat_ClearFreeList(interp);
     _PyList_ClearFreeList(interp);
     _PyDict_ClearFreeList(interp);
+    _PyGen_ClearFreeList(interp);
     _PyAsyncGen_ClearFreeLists(interp);
     _PyContext_ClearFreeList(interp);
 }
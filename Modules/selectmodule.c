@@ -1537,34 +1537,15 @@ select_epoll_unregister_impl(pyEpoll_Object *self, int fd)
     return pyepoll_internal_ctl(self->epfd, EPOLL_CTL_DEL, fd, 0);
 }
 
-/*[clinic input]
-select.epoll.poll
-
-    timeout as timeout_obj: object = None
-      the maximum time to wait in seconds (as float);
-      a timeout of None or -1 makes poll wait indefinitely
-    maxevents: int = -1
-      the maximum number of events returned; -1 means no limit
-
-Wait for events on the epoll file descriptor.
-
-Returns a list containing any descriptors that have events to report,
-as a list of (fd, events) 2-tuples.
-[clinic start generated code]*/
-
-static PyObject *
-select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
-                       int maxevents)
-/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+/* Wait for events on the epoll object, retrying on EINTR.
+   Return the number of events stored in evs, or -1 on error. */
+static int
+pyepoll_wait(pyEpoll_Object *self, PyObject *timeout_obj,
+             struct epoll_event *evs, int maxevents)
 {
-    int nfds, i;
-    PyObject *elist = NULL, *etuple = NULL;
-    struct epoll_event *evs = NULL;
+    int nfds;
     _PyTime_t timeout = -1, ms = -1, deadline = 0;
 
-    if (self->epfd < 0)
-        return pyepoll_err_closed();
-
     if (timeout_obj != Py_None) {
         /* epoll_wait() has a resolution of 1 millisecond, round towards
            infinity to wait at least timeout seconds. */
@@ -1574,13 +1555,13 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
                 PyErr_SetString(PyExc_TypeError,
                                 "timeout must be an integer or None");
             }
-            return NULL;
+            return -1;
         }
 
         ms = _PyTime_AsMilliseconds(timeout, _PyTime_ROUND_CEILING);
         if (ms < INT_MIN || ms > INT_MAX) {
             PyErr_SetString(PyExc_OverflowError, "timeout is too large");
-            return NULL;
+            return -1;
         }
         /* epoll_wait(2) treats all arbitrary negative numbers the same
            for the timeout argument, but -1 is the documented way to block
@@ -1598,22 +1579,6 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
         }
     }
 
-    if (maxevents == -1) {
-        maxevents = FD_SETSIZE-1;
-    }
-    else if (maxevents < 1) {
-        PyErr_Format(PyExc_ValueError,
-                     "maxevents must be greater than 0, got %d",
-                     maxevents);
-        return NULL;
-    }
-
-    evs = PyMem_New(struct epoll_event, maxevents);
-    if (evs == NULL) {
-        PyErr_NoMemory();
-        return NULL;
-    }
-
     do {
         Py_BEGIN_ALLOW_THREADS
         errno = 0;
@@ -1625,7 +1590,7 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
         /* poll() was interrupted by a signal */
         if (PyErr_CheckSignals())
-            goto error;
+            return -1;
 
         if (timeout >= 0) {
             timeout = _PyDeadline_Get(deadline);
@@ -1640,6 +1605,56 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
     if (nfds < 0) {
         PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    return nfds;
+}
+
+/*[clinic input]
+select.epoll.poll
+
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll wait indefinitely
+    maxevents: int = -1
+      the maximum number of events returned; -1 means no limit
+
+Wait for events on the epoll file descriptor.
+
+Returns a list containing any descriptors that have events to report,
+as a list of (fd, events) 2-tuples.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
+                       int maxevents)
+/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+{
+    int nfds, i;
+    PyObject *elist = NULL, *etuple = NULL;
+    struct epoll_event *evs = NULL;
+
+    if (self->epfd < 0)
+        return pyepoll_err_closed();
+
+    if (maxevents == -1) {
+        maxevents = FD_SETSIZE-1;
+    }
+    else if (maxevents < 1) {
+        PyErr_Format(PyExc_ValueError,
+                     "maxevents must be greater than 0, got %d",
+                     maxevents);
+        return NULL;
+    }
+
+    evs = PyMem_New(struct epoll_event, maxevents);
+    if (evs == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    nfds = pyepoll_wait(self, timeout_obj, evs, maxevents);
+    if (nfds < 0) {
         goto error;
     }
 
@@ -1662,6 +1677,105 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
     return elist;
 }
 
+/* Return 1 if the buffer holds native unsigned 64-bit integers:
+   'Q', or 'L' / 'N' where those are 8 bytes wide. */
+static int
+is_uint64_format(Py_buffer *view)
+{
+    const char *fmt = view->format;
+
+    if (view->itemsize != sizeof(uint64_t) || fmt == NULL) {
+        return 0;
+    }
+    if (*fmt == '@' || *fmt == '=') {
+        fmt++;
+    }
+    return ((fmt[0] == 'Q' || fmt[0] == 'L' || fmt[0] == 'N') &&
+            fmt[1] == '\0');
+}
+
+/*[clinic input]
+select.epoll.poll_into
+
+    buffer as buffer_obj: object
+      a writable buffer of unsigned 64-bit integers, such as array('Q')
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll wait indefinitely
+
+Wait for events on the epoll file descriptor, storing them into buffer.
+
+Each event is stored as two consecutive integers, the descriptor and
+its events, so at most len(buffer) // 2 events are reported.
+Returns the number of events stored.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_into_impl(pyEpoll_Object *self, PyObject *buffer_obj,
+                            PyObject *timeout_obj)
+/*[clinic end generated code: output=bbf6a3e3e3023c56 input=6123b0989fde40a6]*/
+{
+    struct epoll_event small_evs[64];
+    struct epoll_event *evs = small_evs;
+    Py_buffer buffer;
+    uint64_t *out;
+    Py_ssize_t maxevents;
+    PyObject *result = NULL;
+
+    if (self->epfd < 0)
+        return pyepoll_err_closed();
+
+    if (PyObject_GetBuffer(buffer_obj, &buffer,
+                           PyBUF_WRITABLE | PyBUF_FORMAT |
+                           PyBUF_C_CONTIGUOUS) < 0)
+    {
+        PyErr_Clear();
+        PyErr_Format(PyExc_TypeError,
+                     "poll_into() argument 'buffer' must be a writable "
+                     "contiguous buffer, not %.50s",
+                     Py_TYPE(buffer_obj)->tp_name);
+        return NULL;
+    }
+    if (!is_uint64_format(&buffer)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer must be a buffer of unsigned "
+                        "64-bit integers");
+        goto done;
+    }
+    out = (uint64_t *)buffer.buf;
+    maxevents = buffer.len / (2 * sizeof(uint64_t));
+    if (maxevents < 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer is too small to hold an event");
+        goto done;
+    }
+    if (maxevents > INT_MAX) {
+        maxevents = INT_MAX;
+    }
+    if (maxevents > (Py_ssize_t)Py_ARRAY_LENGTH(small_evs)) {
+        evs = PyMem_New(struct epoll_event, maxevents);
+        if (evs == NULL) {
+            PyErr_NoMemory();
+            goto done;
+        }
+    }
+
+    int nfds = pyepoll_wait(self, timeout_obj, evs, (int)maxevents);
+    for (int i = 0; i < nfds; i++) {
+        out[2 * i] = (uint64_t)evs[i].data.fd;
+        out[2 * i + 1] = evs[i].events;
+    }
+    if (evs != small_evs) {
+        PyMem_Free(evs);
+    }
+    if (nfds >= 0) {
+        result = PyLong_FromLong(nfds);
+    }
+done:
+    PyBuffer_Release(&buffer);
+    return result;
+}
+
 
 /*[clinic input]
 select.epoll.__enter__
@@ -2445,6 +2559,7 @@ static PyMethodDef pyepoll_methods[] = {
     SELECT_EPOLL_REGISTER_METHODDEF
     SELECT_EPOLL_UNREGISTER_METHODDEF
     SELECT_EPOLL_POLL_METHODDEF
+    SELECT_EPOLL_POLL_INTO_METHODDEF
     SELECT_EPOLL___ENTER___METHODDEF
     SELECT_EPOLL___EXIT___METHODDEF
     {NULL,      NULL},
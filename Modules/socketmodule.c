@@ -3996,6 +3996,143 @@ PyDoc_STRVAR(recvfrom_into_doc,
 Like recv_into(buffer[, nbytes[, flags]]) but also return the sender's address info.");
 #endif
 
+#if defined(HAVE_RECVMMSG) || defined(HAVE_SENDMMSG)
+/* Upper bound on the number of messages handled by one recvmmsg() or
+   sendmmsg() call.  Linux silently caps vlen at UIO_MAXIOV anyway. */
+#define SOCK_MMSG_MAX 1024
+#endif
+
+#ifdef HAVE_RECVMMSG
+struct sock_recvmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_recvmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_recvmmsg *ctx = data;
+
+    ctx->result = recvmmsg(s->sock_fd, ctx->msgvec, ctx->vlen, ctx->flags,
+                           NULL);
+    return (ctx->result >= 0);
+}
+
+/* s.recvmmsg_into(buffer, bufsize[, flags]) method */
+
+static PyObject *
+sock_recvmmsg_into(PySocketSockObject *s, PyObject *args)
+{
+    Py_buffer pbuf;
+    Py_ssize_t bufsize, nmsgs, i;
+    int flags = 0;
+    socklen_t addrbuflen;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    sock_addr_t *addrbufs = NULL;
+    struct sock_recvmmsg ctx;
+    PyObject *retval = NULL;
+
+    if (!PyArg_ParseTuple(args, "w*n|i:recvmmsg_into",
+                          &pbuf, &bufsize, &flags))
+        return NULL;
+
+    if (bufsize <= 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "non-positive bufsize in recvmmsg_into");
+        goto finally;
+    }
+    nmsgs = pbuf.len / bufsize;
+    if (nmsgs == 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "bufsize is greater than the length of the buffer");
+        goto finally;
+    }
+    if (nmsgs > SOCK_MMSG_MAX)
+        nmsgs = SOCK_MMSG_MAX;
+
+    if (!getsockaddrlen(s, &addrbuflen))
+        goto finally;
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    /* One message per bufsize-sized slot of the buffer. */
+    if ((msgvec = PyMem_New(struct mmsghdr, nmsgs)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nmsgs)) == NULL ||
+        (addrbufs = PyMem_New(sock_addr_t, nmsgs)) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nmsgs * sizeof(struct mmsghdr));
+    for (i = 0; i < nmsgs; i++) {
+        memset(&addrbufs[i], 0, addrbuflen);
+        SAS2SA(&addrbufs[i])->sa_family = AF_UNSPEC;
+        iovs[i].iov_base = (char *)pbuf.buf + i * bufsize;
+        iovs[i].iov_len = bufsize;
+        msgvec[i].msg_hdr.msg_name = SAS2SA(&addrbufs[i]);
+        msgvec[i].msg_hdr.msg_namelen = addrbuflen;
+        msgvec[i].msg_hdr.msg_iov = &iovs[i];
+        msgvec[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nmsgs;
+    ctx.flags = flags;
+#ifdef MSG_WAITFORONE
+    /* Don't block waiting for the buffer to fill up once a message
+       has been received. */
+    ctx.flags |= MSG_WAITFORONE;
+#endif
+    if (sock_call(s, 0, sock_recvmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    if ((retval = PyList_New(ctx.result)) == NULL)
+        goto finally;
+    for (i = 0; i < ctx.result; i++) {
+        struct msghdr *hdr = &msgvec[i].msg_hdr;
+        PyObject *addr, *item;
+
+        addr = makesockaddr(s->sock_fd, SAS2SA(&addrbufs[i]),
+                            ((hdr->msg_namelen > addrbuflen) ?
+                             addrbuflen : hdr->msg_namelen),
+                            s->sock_proto);
+        if (addr == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        item = Py_BuildValue("nIN", i * bufsize, msgvec[i].msg_len, addr);
+        if (item == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        PyList_SET_ITEM(retval, i, item);
+    }
+
+finally:
+    PyMem_Free(addrbufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    PyBuffer_Release(&pbuf);
+    return retval;
+}
+
+PyDoc_STRVAR(recvmmsg_into_doc,
+"recvmmsg_into(buffer, bufsize[, flags]) -> list of (offset, nbytes, address)\n\
+\n\
+Receive several datagrams with a single system call.  The buffer is\n\
+split into len(buffer) // bufsize slots of bufsize bytes, and each\n\
+received datagram is stored at the start of its own slot, truncated to\n\
+bufsize bytes if needed.  Return a list with an (offset, nbytes, address)\n\
+tuple for each datagram received, where offset is the position of its\n\
+slot in the buffer.  The call returns as soon as at least one datagram\n\
+has been received.  The flags argument defaults to 0 and has the same\n\
+meaning as for recv().");
+#endif    /* HAVE_RECVMMSG */
+
 /* The sendmsg() and recvmsg[_into]() methods require a working
    CMSG_LEN().  See the comment near get_CMSG_LEN(). */
 #ifdef CMSG_LEN
@@ -4835,6 +4972,123 @@ the message.  The return value is the number of bytes of non-ancillary\n\
 data sent.");
 #endif    /* CMSG_LEN */
 
+#ifdef HAVE_SENDMMSG
+struct sock_sendmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_sendmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_sendmmsg *ctx = data;
+
+    ctx->result = sendmmsg(s->sock_fd, ctx->msgvec, ctx->vlen, ctx->flags);
+    return (ctx->result >= 0);
+}
+
+/* s.sendmmsg(messages[, flags]) method */
+
+static PyObject *
+sock_sendmmsg(PySocketSockObject *s, PyObject *args)
+{
+    int flags = 0;
+    Py_ssize_t i, nitems, nbufs = 0;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    sock_addr_t *addrbufs = NULL;
+    Py_buffer *bufs = NULL;
+    PyObject *messages_arg, *fast, *retval = NULL;
+    struct sock_sendmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|i:sendmmsg", &messages_arg, &flags))
+        return NULL;
+
+    if ((fast = PySequence_Fast(messages_arg,
+                                "sendmmsg() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > SOCK_MMSG_MAX)
+        nitems = SOCK_MMSG_MAX;
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+
+    if ((msgvec = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (addrbufs = PyMem_New(sock_addr_t, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    while (nbufs < nitems) {
+        PyObject *addro;
+
+        i = nbufs;
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, i),
+                         "(y*O);sendmmsg() argument 1 must be an iterable "
+                         "of (data, address) pairs",
+                         &bufs[i], &addro))
+            goto finally;
+        nbufs++;
+        iovs[i].iov_base = bufs[i].buf;
+        iovs[i].iov_len = bufs[i].len;
+        msgvec[i].msg_hdr.msg_iov = &iovs[i];
+        msgvec[i].msg_hdr.msg_iovlen = 1;
+        if (addro != Py_None) {
+            int addrlen;
+
+            if (!getsockaddrarg(s, addro, &addrbufs[i], &addrlen,
+                                "sendmmsg"))
+                goto finally;
+            msgvec[i].msg_hdr.msg_name = SAS2SA(&addrbufs[i]);
+            msgvec[i].msg_hdr.msg_namelen = addrlen;
+        }
+        if (PySys_Audit("socket.sendmsg", "OO", s, addro) < 0)
+            goto finally;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 1, sock_sendmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyLong_FromLong(ctx.result);
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(addrbufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+}
+
+PyDoc_STRVAR(sendmmsg_doc,
+"sendmmsg(messages[, flags]) -> count\n\
+\n\
+Send several datagrams with a single system call.  The messages argument\n\
+must be an iterable of (data, address) pairs, where data is a bytes-like\n\
+object and address is the destination address, or None for a connected\n\
+socket.  At most 1024 messages are sent per call.  The flags argument\n\
+defaults to 0 and has the same meaning as for send().  Return the number\n\
+of messages sent, which may be less than the number of messages given;\n\
+an error sending the first message raises an exception.");
+#endif    /* HAVE_SENDMMSG */
+
 #ifdef HAVE_SOCKADDR_ALG
 static PyObject*
 sock_sendmsg_afalg(PySocketSockObject *self, PyObject *args, PyObject *kwds)
@@ -5200,6 +5454,14 @@ static PyMethodDef sock_methods[] = {
     {"sendmsg",           (PyCFunction)sock_sendmsg, METH_VARARGS,
                       sendmsg_doc},
 #endif
+#ifdef HAVE_RECVMMSG
+    {"recvmmsg_into",     (PyCFunction)sock_recvmmsg_into, METH_VARARGS,
+                      recvmmsg_into_doc},
+#endif
+#ifdef HAVE_SENDMMSG
+    {"sendmmsg",          (PyCFunction)sock_sendmmsg, METH_VARARGS,
+                      sendmmsg_doc},
+#endif
 #ifdef HAVE_SOCKADDR_ALG
     {"sendmsg_afalg",     _PyCFunction_CAST(sock_sendmsg_afalg), METH_VARARGS | METH_KEYWORDS,
                       sendmsg_afalg_doc},
@@ -1692,6 +1692,9 @@ free_monitoring_data(_PyCoMonitoringData *data)
     if (data->per_instruction_tools) {
         PyMem_Free(data->per_instruction_tools);
     }
+    if (data->coverage) {
+        _PyMonitoring_DetachCoverageData(data->coverage);
+    }
     PyMem_Free(data);
 }
 
@@ -16,6 +16,8 @@
 #include "pystats.h"
 
 static PyObject *gen_close(PyGenObject *, PyObject *);
+static PyGenObject *gen_alloc(PyTypeObject *, int);
+static int gen_freelist_push(PyGenObject *, int);
 static PyObject *async_gen_asend_new(PyAsyncGenObject *, PyObject *);
 static PyObject *async_gen_athrow_new(PyAsyncGenObject *, PyObject *);
 
@@ -150,14 +152,18 @@ gen_dealloc(PyGenObject *gen)
         frame->previous = NULL;
         _PyFrame_ClearExceptCode(frame);
     }
-    if (_PyGen_GetCode(gen)->co_flags & CO_COROUTINE) {
+    PyCodeObject *code = _PyGen_GetCode(gen);
+    if (code->co_flags & CO_COROUTINE) {
         Py_CLEAR(((PyCoroObject *)gen)->cr_origin_or_finalizer);
     }
-    Py_DECREF(_PyGen_GetCode(gen));
+    int slots = _PyFrame_NumSlotsForCodeObject(code);
+    Py_DECREF(code);
     Py_CLEAR(gen->gi_name);
     Py_CLEAR(gen->gi_qualname);
     _PyErr_ClearExcState(&gen->gi_exc_state);
-    PyObject_GC_Del(gen);
+    if (!gen_freelist_push(gen, slots)) {
+        PyObject_GC_Del(gen);
+    }
 }
 
 static PySendResult
@@ -883,7 +889,7 @@ make_gen(PyTypeObject *type, PyFunctionObject *func)
 {
     PyCodeObject *code = (PyCodeObject *)func->func_code;
     int slots = _PyFrame_NumSlotsForCodeObject(code);
-    PyGenObject *gen = PyObject_GC_NewVar(PyGenObject, type, slots);
+    PyGenObject *gen = gen_alloc(type, slots);
     if (gen == NULL) {
         return NULL;
     }
@@ -954,7 +960,7 @@ gen_new_with_qualname(PyTypeObject *type, PyFrameObject *f,
 {
     PyCodeObject *code = f->f_frame->f_code;
     int size = code->co_nlocalsplus + code->co_stacksize;
-    PyGenObject *gen = PyObject_GC_NewVar(PyGenObject, type, size);
+    PyGenObject *gen = gen_alloc(type, size);
     if (gen == NULL) {
         Py_DECREF(f);
         return NULL;
@@ -985,6 +991,109 @@ gen_new_with_qualname(PyTypeObject *type, PyFrameObject *f,
     return (PyObject *)gen;
 }
 
+/* Generator freelists */
+
+#define STATE (interp->gen)
+
+/* Allocate an uninitialized generator, coroutine or asynchronous generator
+   object with room for a frame of the given number of slots. */
+static PyGenObject *
+gen_alloc(PyTypeObject *type, int slots)
+{
+#if _PyGen_NFREELISTS > 0
+    if (0 < slots && slots <= _PyGen_MAXSAVESIZE) {
+        PyInterpreterState *interp = _PyInterpreterState_GET();
+        Py_ssize_t index = slots - 1;
+        PyGenObject *gen = STATE.free_list[index];
+        if (gen != NULL) {
+            STATE.free_list[index] = (PyGenObject *)gen->gi_weakreflist;
+            STATE.numfree[index]--;
+            Py_SET_TYPE(gen, type);
+            _Py_NewReference((PyObject *)gen);
+            OBJECT_STAT_INC(from_freelist);
+            OBJECT_STAT_INC(gen_freelist_hits);
+            return gen;
+        }
+        OBJECT_STAT_INC(gen_freelist_misses);
+    }
+#endif
+    return PyObject_GC_NewVar(PyGenObject, type, slots);
+}
+
+/* Generators are not variable-size objects, so the number of slots of
+   the frame has to be passed by the caller. */
+static int
+gen_freelist_push(PyGenObject *gen, int slots)
+{
+#if _PyGen_NFREELISTS > 0
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    Py_ssize_t index = slots - 1;
+    /* numfree is -1 once the freelists have been finalized */
+    if (0 <= index && index < _PyGen_NFREELISTS
+        && 0 <= STATE.numfree[index]
+        && STATE.numfree[index] < _PyGen_MAXFREELIST)
+    {
+        /* The object may be reused for a different function, whose
+           finalizer has not been called yet. */
+        _PyGC_CLEAR_FINALIZED((PyObject *)gen);
+        gen->gi_weakreflist = (PyObject *)STATE.free_list[index];
+        STATE.free_list[index] = gen;
+        STATE.numfree[index]++;
+        OBJECT_STAT_INC(to_freelist);
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+static void
+gen_freelist_clear(PyInterpreterState *interp, int fini)
+{
+#if _PyGen_NFREELISTS > 0
+    for (Py_ssize_t i = 0; i < _PyGen_NFREELISTS; i++) {
+        PyGenObject *gen = STATE.free_list[i];
+        STATE.free_list[i] = NULL;
+        STATE.numfree[i] = fini ? -1 : 0;
+        while (gen) {
+            PyGenObject *next = (PyGenObject *)gen->gi_weakreflist;
+            PyObject_GC_Del(gen);
+            gen = next;
+        }
+    }
+#endif
+}
+
+void
+_PyGen_ClearFreeList(PyInterpreterState *interp)
+{
+    gen_freelist_clear(interp, 0);
+}
+
+void
+_PyGen_Fini(PyInterpreterState *interp)
+{
+    gen_freelist_clear(interp, 1);
+}
+
+/* Print summary info about the state of the generator freelists */
+void
+_PyGen_DebugMallocStats(FILE *out)
+{
+#if _PyGen_NFREELISTS > 0
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    for (int i = 0; i < _PyGen_NFREELISTS; i++) {
+        int slots = i + 1;
+        char buf[128];
+        PyOS_snprintf(buf, sizeof(buf),
+                      "free %d-slot PyGenObject", slots);
+        _PyDebugAllocatorStats(out, buf, STATE.numfree[i],
+                               _PyObject_VAR_SIZE(&PyGen_Type, slots));
+    }
+#endif
+}
+
+#undef STATE
+
 PyObject *
 PyGen_NewWithQualName(PyFrameObject *f, PyObject *name, PyObject *qualname)
 {
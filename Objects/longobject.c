@@ -1749,6 +1749,344 @@ pylong_int_to_decimal_string(PyObject *aa,
 }
 #endif /* WITH_PYLONG_MODULE */
 
+/* An upper bound for the number of base _PyLong_DECIMAL_BASE digits
+   needed to express an n-digit int, plus one spare digit; see
+   long_to_decimal_string_internal(). */
+#define DECIMAL_DIGITS_BOUND(n) \
+    (2 + (n) + (n) / ((33 * _PyLong_DECIMAL_SHIFT) / \
+                      (10 * PyLong_SHIFT - 33 * _PyLong_DECIMAL_SHIFT)))
+
+/* Convert the size_a base _PyLong_BASE digits at pin to base
+   _PyLong_DECIMAL_BASE digits at pout, following Knuth (TAOCP, Volume 2
+   (3rd edn), section 4.4, Method 1b).  pout must have room for
+   DECIMAL_DIGITS_BOUND(size_a) digits.  Returns the number of decimal
+   digits (0 if the input is zero), or -1 if a signal handler raised. */
+static Py_ssize_t
+digits_to_decimal(const digit *pin, Py_ssize_t size_a, digit *pout)
+{
+    Py_ssize_t size = 0, i, j;
+
+    for (i = size_a; --i >= 0; ) {
+        digit hi = pin[i];
+        for (j = 0; j < size; j++) {
+            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
+            hi = (digit)(z / _PyLong_DECIMAL_BASE);
+            pout[j] = (digit)(z - (twodigits)hi *
+                              _PyLong_DECIMAL_BASE);
+        }
+        while (hi) {
+            pout[size++] = hi % _PyLong_DECIMAL_BASE;
+            hi /= _PyLong_DECIMAL_BASE;
+        }
+        /* check for keyboard interrupt */
+        SIGCHECK({
+                return -1;
+            });
+    }
+    return size;
+}
+
+/* Subquadratic int to decimal conversion.  The binary digits are split
+   in halves, each half is converted recursively, and the halves are
+   combined as hi * 2**(k*PyLong_SHIFT) + lo in base _PyLong_DECIMAL_BASE,
+   using Karatsuba multiplication on arrays of decimal digits and a cache
+   of the needed powers of two.  This is the algorithm of
+   _pylong.int_to_decimal() without the decimal module. */
+
+/* Sizes, in digits, below which the quadratic algorithms are faster. */
+#define DEC_KARATSUBA_CUTOFF 40
+#define DEC_DC_CUTOFF 150
+/* Sizes, in digits, above which long_to_decimal_string_internal() uses
+   the subquadratic algorithm, and above which it switches to _pylong,
+   whose decimal multiplication is asymptotically faster still. */
+#define DEC_DC_THRESHOLD 300
+#define DEC_PYLONG_THRESHOLD 15000
+
+/* Return the number of digits of the decimal digit vector a[0:n]. */
+static Py_ssize_t
+dec_normalize(const digit *a, Py_ssize_t n)
+{
+    while (n > 0 && a[n - 1] == 0) {
+        n--;
+    }
+    return n;
+}
+
+/* x[0:nx] += y[0:ny] for decimal digit vectors, nx >= ny.  Returns the
+   carry out of x. */
+static digit
+dec_iadd(digit *x, Py_ssize_t nx, const digit *y, Py_ssize_t ny)
+{
+    digit carry = 0;
+    Py_ssize_t i;
+
+    assert(nx >= ny);
+    for (i = 0; i < ny; i++) {
+        carry += x[i] + y[i];
+        x[i] = carry >= _PyLong_DECIMAL_BASE ?
+               carry - _PyLong_DECIMAL_BASE : carry;
+        carry = carry >= _PyLong_DECIMAL_BASE;
+    }
+    for (; carry && i < nx; i++) {
+        carry += x[i];
+        x[i] = carry >= _PyLong_DECIMAL_BASE ?
+               carry - _PyLong_DECIMAL_BASE : carry;
+        carry = carry >= _PyLong_DECIMAL_BASE;
+    }
+    return carry;
+}
+
+/* x[0:nx] -= y[0:ny] for decimal digit vectors, x >= y. */
+static void
+dec_isub(digit *x, Py_ssize_t nx, const digit *y, Py_ssize_t ny)
+{
+    digit borrow = 0;
+    Py_ssize_t i;
+
+    assert(nx >= ny);
+    for (i = 0; i < ny; i++) {
+        digit t = y[i] + borrow;
+        borrow = x[i] < t;
+        x[i] = borrow ? x[i] + _PyLong_DECIMAL_BASE - t : x[i] - t;
+    }
+    for (; borrow && i < nx; i++) {
+        borrow = x[i] == 0;
+        x[i] = borrow ? _PyLong_DECIMAL_BASE - 1 : x[i] - 1;
+    }
+    assert(borrow == 0);
+}
+
+/* out[0:na+nb] = a[0:na] * b[0:nb] for decimal digit vectors.  Returns
+   -1 with an exception set if out of memory. */
+static int
+dec_mul(const digit *a, Py_ssize_t na, const digit *b, Py_ssize_t nb,
+        digit *out)
+{
+    Py_ssize_t i, j, m, nsa, nsb, nz1;
+    digit *tmp;
+
+    if (na < nb) {
+        const digit *t = a; a = b; b = t;
+        m = na; na = nb; nb = m;
+    }
+    if (nb <= DEC_KARATSUBA_CUTOFF) {
+        memset(out, 0, (na + nb) * sizeof(digit));
+        for (i = 0; i < nb; i++) {
+            twodigits carry = 0, bi = b[i];
+            if (bi == 0) {
+                continue;
+            }
+            for (j = 0; j < na; j++) {
+                carry += out[i + j] + bi * a[j];
+                out[i + j] = (digit)(carry % _PyLong_DECIMAL_BASE);
+                carry /= _PyLong_DECIMAL_BASE;
+            }
+            out[i + na] = (digit)carry;
+        }
+        return 0;
+    }
+    if (2 * nb <= na) {
+        /* Lopsided: multiply b by nb-digit slices of a. */
+        tmp = PyMem_New(digit, 2 * nb);
+        if (tmp == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        memset(out, 0, (na + nb) * sizeof(digit));
+        for (i = 0; i < na; i += nb) {
+            m = Py_MIN(nb, na - i);
+            if (dec_mul(a + i, m, b, nb, tmp) < 0) {
+                PyMem_Free(tmp);
+                return -1;
+            }
+            (void)dec_iadd(out + i, na + nb - i, tmp, m + nb);
+        }
+        PyMem_Free(tmp);
+        return 0;
+    }
+
+    /* Karatsuba: a = a1*B**m + a0 and b = b1*B**m + b0, with b1 nonempty
+       since nb > na/2.  z0 = a0*b0 and z2 = a1*b1 go straight to out. */
+    m = na / 2;
+    nsa = na - m + 1;
+    nsb = Py_MAX(m, nb - m) + 1;
+    tmp = PyMem_New(digit, nsa + nsb + nsa + nsb);
+    if (tmp == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    digit *sa = tmp, *sb = tmp + nsa, *z1 = tmp + nsa + nsb;
+    if (dec_mul(a, m, b, m, out) < 0 ||
+        dec_mul(a + m, na - m, b + m, nb - m, out + 2 * m) < 0)
+    {
+        PyMem_Free(tmp);
+        return -1;
+    }
+    memcpy(sa, a + m, (na - m) * sizeof(digit));
+    sa[na - m] = dec_iadd(sa, na - m, a, m);
+    if (m >= nb - m) {
+        memcpy(sb, b, m * sizeof(digit));
+        sb[m] = dec_iadd(sb, m, b + m, nb - m);
+    }
+    else {
+        memcpy(sb, b + m, (nb - m) * sizeof(digit));
+        sb[nb - m] = dec_iadd(sb, nb - m, b, m);
+    }
+    if (dec_mul(sa, nsa, sb, nsb, z1) < 0) {
+        PyMem_Free(tmp);
+        return -1;
+    }
+    /* z1 = (a0 + a1)*(b0 + b1) - z0 - z2 */
+    nz1 = nsa + nsb;
+    dec_isub(z1, nz1, out, dec_normalize(out, 2 * m));
+    dec_isub(z1, nz1, out + 2 * m, dec_normalize(out + 2 * m, na + nb - 2 * m));
+    nz1 = dec_normalize(z1, nz1);
+    assert(nz1 <= na + nb - m);
+    (void)dec_iadd(out + m, na + nb - m, z1, nz1);
+    PyMem_Free(tmp);
+    return 0;
+}
+
+/* Cache of 2**(k*PyLong_SHIFT) as decimal digit vectors. */
+typedef struct {
+    Py_ssize_t k;
+    Py_ssize_t size;
+    digit *digits;
+} dec_power;
+
+typedef struct {
+    Py_ssize_t len;
+    Py_ssize_t allocated;
+    dec_power *items;
+} dec_power_cache;
+
+static void
+dec_power_cache_clear(dec_power_cache *cache)
+{
+    for (Py_ssize_t i = 0; i < cache->len; i++) {
+        PyMem_Free(cache->items[i].digits);
+    }
+    PyMem_Free(cache->items);
+}
+
+static const dec_power *
+dec_power_get(dec_power_cache *cache, Py_ssize_t k)
+{
+    dec_power p;
+    Py_ssize_t i;
+
+    for (i = 0; i < cache->len; i++) {
+        if (cache->items[i].k == k) {
+            return &cache->items[i];
+        }
+    }
+    p.k = k;
+    p.digits = PyMem_New(digit, DECIMAL_DIGITS_BOUND(k + 1));
+    if (p.digits == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    if (k <= DEC_DC_CUTOFF) {
+        digit one[DEC_DC_CUTOFF + 1] = {0};
+        one[k] = 1;
+        p.size = digits_to_decimal(one, k + 1, p.digits);
+    }
+    else {
+        /* The entries are pointed to only until the next lookup. */
+        const dec_power *p1 = dec_power_get(cache, k / 2);
+        if (p1 == NULL) {
+            PyMem_Free(p.digits);
+            return NULL;
+        }
+        Py_ssize_t size1 = p1->size;
+        const digit *digits1 = p1->digits;
+        const dec_power *p2 = dec_power_get(cache, k - k / 2);
+        if (p2 == NULL || dec_mul(digits1, size1, p2->digits, p2->size,
+                                  p.digits) < 0)
+        {
+            PyMem_Free(p.digits);
+            return NULL;
+        }
+        p.size = dec_normalize(p.digits, size1 + p2->size);
+    }
+    if (p.size < 0) {
+        PyMem_Free(p.digits);
+        return NULL;
+    }
+    if (cache->len == cache->allocated) {
+        Py_ssize_t allocated = cache->allocated ? 2 * cache->allocated : 16;
+        dec_power *items = PyMem_Resize(cache->items, dec_power, allocated);
+        if (items == NULL) {
+            PyMem_Free(p.digits);
+            PyErr_NoMemory();
+            return NULL;
+        }
+        cache->items = items;
+        cache->allocated = allocated;
+    }
+    cache->items[cache->len] = p;
+    return &cache->items[cache->len++];
+}
+
+/* Convert the size_a digits at pin to DECIMAL_DIGITS_BOUND(size_a)
+   decimal digits at pout.  Returns the number of significant decimal
+   digits, or -1 on error. */
+static Py_ssize_t
+digits_to_decimal_dc(const digit *pin, Py_ssize_t size_a, digit *pout,
+                     dec_power_cache *cache)
+{
+    Py_ssize_t k, size_lo, size_hi, size_p, size;
+    const dec_power *p;
+    digit *lo;
+
+    while (size_a > 0 && pin[size_a - 1] == 0) {
+        size_a--;
+    }
+    if (size_a <= DEC_DC_CUTOFF) {
+        return digits_to_decimal(pin, size_a, pout);
+    }
+    k = size_a / 2;
+    lo = PyMem_New(digit, DECIMAL_DIGITS_BOUND(k));
+    if (lo == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    size_lo = digits_to_decimal_dc(pin, k, lo, cache);
+    if (size_lo < 0) {
+        goto error;
+    }
+    /* The high half goes to pout, then moves up to make room for the
+       product. */
+    size_hi = digits_to_decimal_dc(pin + k, size_a - k, pout, cache);
+    if (size_hi < 0 || (p = dec_power_get(cache, k)) == NULL) {
+        goto error;
+    }
+    size_p = p->size;
+    digit *hi = PyMem_New(digit, size_hi);
+    if (hi == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    memcpy(hi, pout, size_hi * sizeof(digit));
+    if (dec_mul(hi, size_hi, p->digits, size_p, pout) < 0) {
+        PyMem_Free(hi);
+        goto error;
+    }
+    PyMem_Free(hi);
+    size = size_hi + size_p;
+    assert(size <= DECIMAL_DIGITS_BOUND(size_a));
+    assert(size_lo <= size);
+    if (dec_iadd(pout, size, lo, size_lo) != 0) {
+        Py_UNREACHABLE();
+    }
+    PyMem_Free(lo);
+    return dec_normalize(pout, size);
+
+error:
+    PyMem_Free(lo);
+    return -1;
+}
+
 /* Convert an integer to a base 10 string.  Returns a new non-shared
    string.  (Return value is non-shared so that callers can modify the
    returned value if necessary.) */
@@ -1765,7 +2103,6 @@ long_to_decimal_string_internal(PyObject *aa,
     Py_ssize_t size, strlen, size_a, i, j;
     digit *pout, *pin, rem, tenpow;
     int negative;
-    int d;
     int kind;
 
     a = (PyLongObject *)aa;
@@ -1794,7 +2131,7 @@ long_to_decimal_string_internal(PyObject *aa,
     }
 
 #if WITH_PYLONG_MODULE
-    if (size_a > 1000) {
+    if (size_a > DEC_PYLONG_THRESHOLD) {
         /* Switch to _pylong.int_to_decimal_string(). */
         return pylong_int_to_decimal_string(aa,
                                          p_output,
@@ -1817,38 +2154,30 @@ long_to_decimal_string_internal(PyObject *aa,
              size_a + size_a / d < size_a + size_a / floor(d),
        where d = (3.3 * _PyLong_DECIMAL_SHIFT) /
                  (PyLong_SHIFT - 3.3 * _PyLong_DECIMAL_SHIFT)
+
+       DECIMAL_DIGITS_BOUND() adds a spare digit for the subquadratic
+       algorithm.
     */
-    d = (33 * _PyLong_DECIMAL_SHIFT) /
-        (10 * PyLong_SHIFT - 33 * _PyLong_DECIMAL_SHIFT);
     assert(size_a < PY_SSIZE_T_MAX/2);
-    size = 1 + size_a + size_a / d;
-    scratch = _PyLong_New(size);
+    scratch = _PyLong_New(DECIMAL_DIGITS_BOUND(size_a));
     if (scratch == NULL)
         return -1;
 
     /* convert array of base _PyLong_BASE digits in pin to an array of
-       base _PyLong_DECIMAL_BASE digits in pout, following Knuth (TAOCP,
-       Volume 2 (3rd edn), section 4.4, Method 1b). */
+       base _PyLong_DECIMAL_BASE digits in pout */
     pin = a->long_value.ob_digit;
     pout = scratch->long_value.ob_digit;
-    size = 0;
-    for (i = size_a; --i >= 0; ) {
-        digit hi = pin[i];
-        for (j = 0; j < size; j++) {
-            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
-            hi = (digit)(z / _PyLong_DECIMAL_BASE);
-            pout[j] = (digit)(z - (twodigits)hi *
-                              _PyLong_DECIMAL_BASE);
-        }
-        while (hi) {
-            pout[size++] = hi % _PyLong_DECIMAL_BASE;
-            hi /= _PyLong_DECIMAL_BASE;
-        }
-        /* check for keyboard interrupt */
-        SIGCHECK({
-                Py_DECREF(scratch);
-                return -1;
-            });
+    if (size_a > DEC_DC_THRESHOLD) {
+        dec_power_cache cache = {0, 0, NULL};
+        size = digits_to_decimal_dc(pin, size_a, pout, &cache);
+        dec_power_cache_clear(&cache);
+    }
+    else {
+        size = digits_to_decimal(pin, size_a, pout);
+    }
+    if (size < 0) {
+        Py_DECREF(scratch);
+        return -1;
     }
     /* pout should have at least one digit, so that the case when a = 0
        works correctly */
@@ -2558,6 +2887,154 @@ long_from_non_binary_base(const char *start, const char *end, Py_ssize_t digits,
     return 0;
 }
 
+/* Subquadratic conversion of a string of decimal digits to an int: the
+   string is split in halves, each half is converted recursively and the
+   halves are combined as (hi * 5**w << w) + lo, where w is the number of
+   digits in lo, using Karatsuba multiplication and a cache of the needed
+   powers of 5.  This is the algorithm of _pylong.int_from_string(). */
+
+/* Number of digits below which the quadratic algorithm is faster. */
+#define STR_DC_CUTOFF 800
+/* Number of digits above which long_from_string_base() uses the
+   subquadratic algorithm. */
+#define STR_DC_THRESHOLD 6000
+/* Number of digits above which it switches to _pylong, whose
+   int_from_string() is the same algorithm: above this, the cost of the
+   multiplications hides its call overhead. */
+#define STR_PYLONG_THRESHOLD 25000
+
+/* Each level of the recursion needs at most three distinct powers, and
+   there are fewer levels than bits in a Py_ssize_t. */
+typedef struct {
+    Py_ssize_t len;
+    Py_ssize_t w[3 * 8 * SIZEOF_SIZE_T];
+    PyObject *pow5[3 * 8 * SIZEOF_SIZE_T];
+} pow5_cache;
+
+static PyObject *long_add(PyLongObject *a, PyLongObject *b);
+static PyObject *long_mul(PyLongObject *a, PyLongObject *b);
+static PyObject *long_pow(PyObject *v, PyObject *w, PyObject *x);
+
+/* Return a borrowed reference to 5**w. */
+static PyObject *
+pow5_get(pow5_cache *cache, Py_ssize_t w)
+{
+    PyObject *result, *exp, *five;
+    Py_ssize_t i;
+
+    for (i = 0; i < cache->len; i++) {
+        if (cache->w[i] == w) {
+            return cache->pow5[i];
+        }
+    }
+    if (w <= STR_DC_CUTOFF) {
+        five = PyLong_FromLong(5);
+        exp = PyLong_FromSsize_t(w);
+        result = (five && exp) ? long_pow(five, exp, Py_None) : NULL;
+        Py_XDECREF(five);
+        Py_XDECREF(exp);
+    }
+    else {
+        PyObject *p1 = pow5_get(cache, w / 2);
+        PyObject *p2 = p1 ? pow5_get(cache, w - w / 2) : NULL;
+        result = p2 ? long_mul((PyLongObject *)p1, (PyLongObject *)p2) : NULL;
+    }
+    if (result == NULL) {
+        return NULL;
+    }
+    assert(cache->len < (Py_ssize_t)Py_ARRAY_LENGTH(cache->w));
+    cache->w[cache->len] = w;
+    cache->pow5[cache->len] = result;
+    return cache->pow5[cache->len++];
+}
+
+/* Convert the n decimal digits at s, which contain no underscores. */
+static PyLongObject *
+str_to_int_dc(const char *s, Py_ssize_t n, pow5_cache *cache)
+{
+    PyLongObject *hi, *lo, *res;
+    PyObject *p, *t;
+    Py_ssize_t w;
+
+    if (n <= STR_DC_CUTOFF) {
+        if (long_from_non_binary_base(s, s + n, n, 10, &res) < 0) {
+            Py_UNREACHABLE();
+        }
+        return res ? long_normalize(res) : NULL;
+    }
+    w = n / 2;
+    hi = str_to_int_dc(s, n - w, cache);
+    if (hi == NULL) {
+        return NULL;
+    }
+    p = pow5_get(cache, w);
+    t = p ? long_mul(hi, (PyLongObject *)p) : NULL;
+    Py_DECREF(hi);
+    if (t == NULL) {
+        return NULL;
+    }
+    Py_SETREF(t, _PyLong_Lshift(t, w));
+    if (t == NULL) {
+        return NULL;
+    }
+    lo = str_to_int_dc(s + n - w, w, cache);
+    if (lo == NULL) {
+        Py_DECREF(t);
+        return NULL;
+    }
+    res = (PyLongObject *)long_add((PyLongObject *)t, lo);
+    Py_DECREF(t);
+    Py_DECREF(lo);
+    return res;
+}
+
+/* Convert the validated decimal digits and underscores in [start, end)
+   with str_to_int_dc().  Same return values as long_from_string_base(). */
+static int
+long_from_decimal_dc(const char *start, const char *end, Py_ssize_t digits,
+                     PyLongObject **res)
+{
+    pow5_cache cache;
+    char *buf = NULL;
+    const char *p;
+
+    if (digits != end - start) {
+        char *q = buf = PyMem_Malloc(digits);
+        if (buf == NULL) {
+            PyErr_NoMemory();
+            *res = NULL;
+            return 0;
+        }
+        for (p = start; p < end; p++) {
+            if (*p != '_') {
+                *q++ = *p;
+            }
+        }
+        start = buf;
+        end = q;
+    }
+    /* The result is freshly allocated, so the caller can set its sign
+       in place.  long_from_non_binary_base() always allocates, and once
+       the leading zeros are dropped str_to_int_dc() only gets values of
+       more than STR_DC_CUTOFF significant digits, so none of its
+       intermediate results can be a shared small int. */
+    while (end - start > 1 && *start == '0') {
+        start++;
+    }
+    if (end - start <= STR_DC_CUTOFF) {
+        long_from_non_binary_base(start, end, end - start, 10, res);
+    }
+    else {
+        cache.len = 0;
+        *res = str_to_int_dc(start, end - start, &cache);
+        for (Py_ssize_t i = 0; i < cache.len; i++) {
+            Py_DECREF(cache.pow5[i]);
+        }
+    }
+    PyMem_Free(buf);
+    return 0;
+}
+
 /* *str points to the first digit in a string of base `base` digits. base is an
  * integer from 2 to 36 inclusive. Here we don't need to worry about prefixes
  * like 0x or leading +- signs. The string should be null terminated consisting
@@ -2652,11 +3129,14 @@ long_from_string_base(const char **str, int base, PyLongObject **res)
             }
         }
 #if WITH_PYLONG_MODULE
-        if (digits > 6000 && base == 10) {
+        if (digits > STR_PYLONG_THRESHOLD && base == 10) {
             /* Switch to _pylong.int_from_string() */
             return pylong_int_from_string(start, end, res);
         }
 #endif
+        if (digits > STR_DC_THRESHOLD && base == 10) {
+            return long_from_decimal_dc(start, end, digits, res);
+        }
         /* Use the quadratic algorithm for non binary bases. */
         return long_from_non_binary_base(start, end, digits, base, res);
     }
@@ -2749,7 +3229,17 @@ PyLong_FromString(const char *str, char **pend, int base)
 
     /* Set sign and normalize */
     if (sign < 0) {
-        _PyLong_FlipSign(z);
+        if (Py_REFCNT(z) == 1) {
+            _PyLong_FlipSign(z);
+        }
+        else {
+            /* _pylong may return a shared object, such as a small int
+               for "-000...05". */
+            Py_SETREF(z, (PyLongObject *)PyNumber_Negative((PyObject *)z));
+            if (z == NULL) {
+                return NULL;
+            }
+        }
     }
     long_normalize(z);
     z = maybe_small_long(z);
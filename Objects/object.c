@@ -7,6 +7,7 @@
 #include "pycore_context.h"       // _PyContextTokenMissing_Type
 #include "pycore_dict.h"          // _PyObject_MakeDictFromInstanceAttributes()
 #include "pycore_floatobject.h"   // _PyFloat_DebugMallocStats()
+#include "pycore_genobject.h"     // _PyGen_DebugMallocStats()
 #include "pycore_initconfig.h"    // _PyStatus_EXCEPTION()
 #include "pycore_namespace.h"     // _PyNamespace_Type
 #include "pycore_object.h"        // _PyType_CheckConsistency(), _Py_FatalRefcountError()
@@ -2336,6 +2337,7 @@ _PyObject_DebugTypeStats(FILE *out)
 {
     _PyDict_DebugMallocStats(out);
     _PyFloat_DebugMallocStats(out);
+    _PyGen_DebugMallocStats(out);
     _PyList_DebugMallocStats(out);
     _PyTuple_DebugMallocStats(out);
 }
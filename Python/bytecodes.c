@@ -2709,6 +2709,7 @@ dummy_func(
             CALL,
             CALL_BOUND_METHOD_EXACT_ARGS,
             CALL_PY_EXACT_ARGS,
+            CALL_PY_TRIVIAL,
             CALL_PY_WITH_DEFAULTS,
             CALL_NO_KW_TYPE_1,
             CALL_NO_KW_STR_1,
@@ -2861,6 +2862,47 @@ dummy_func(
             DISPATCH_INLINED(new_frame);
         }
 
+        // The callee's body is "return <constant>" or "return <argument>"
+        // (see function_is_trivial() in specialize.c), so compute the result
+        // directly instead of pushing a frame. Such a callee cannot raise or
+        // observe its frame, so there is nothing to materialize. Deopt if the
+        // callee is (or is about to be) instrumented, so that monitoring
+        // events are still delivered.
+        inst(CALL_PY_TRIVIAL, (unused/1, func_version/2, method, callable, args[oparg] -- res)) {
+            assert(kwnames == NULL);
+            DEOPT_IF(tstate->interp->eval_frame, CALL);
+            int is_meth = method != NULL;
+            int argcount = oparg;
+            if (is_meth) {
+                callable = method;
+                args--;
+                argcount++;
+            }
+            DEOPT_IF(!PyFunction_Check(callable), CALL);
+            PyFunctionObject *func = (PyFunctionObject *)callable;
+            DEOPT_IF(func->func_version != func_version, CALL);
+            PyCodeObject *code = (PyCodeObject *)func->func_code;
+            DEOPT_IF(code->co_argcount != argcount, CALL);
+            DEOPT_IF(code->_co_instrumentation_version != tstate->interp->monitoring_version, CALL);
+            _Py_CODEUNIT *body = _PyCode_CODE(code);
+            DEOPT_IF(body[0].op.code != RESUME, CALL);
+            if (body[1].op.code == RETURN_CONST) {
+                res = Py_NewRef(GETITEM(code->co_consts, body[1].op.arg));
+            }
+            else {
+                DEOPT_IF(body[1].op.code != LOAD_FAST, CALL);
+                DEOPT_IF(body[2].op.code != RETURN_VALUE, CALL);
+                assert(body[1].op.arg < argcount);
+                res = Py_NewRef(args[body[1].op.arg]);
+            }
+            STAT_INC(CALL, hit);
+            Py_DECREF(callable);
+            for (int i = 0; i < argcount; i++) {
+                Py_DECREF(args[i]);
+            }
+            CHECK_EVAL_BREAKER();
+        }
+
         inst(CALL_PY_WITH_DEFAULTS, (unused/1, func_version/2, method, callable, args[oparg] -- unused)) {
             assert(kwnames == NULL);
             DEOPT_IF(tstate->interp->eval_frame, CALL);
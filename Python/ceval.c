@@ -867,11 +867,14 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
         if (next_instr != here) {
             DISPATCH();
         }
-        if (_PyOpcode_Caches[original_opcode]) {
+        if (_PyOpcode_Caches[_PyOpcode_Deopt[original_opcode]]) {
             _PyBinaryOpCache *cache = (_PyBinaryOpCache *)(next_instr+1);
-            /* Prevent the underlying instruction from specializing
+            /* Prevent the underlying instruction (or the unspecialized
+             * form of a specialized one, when it deopts) from specializing
              * and overwriting the instrumentation. */
-            INCREMENT_ADAPTIVE_COUNTER(cache->counter);
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                INCREMENT_ADAPTIVE_COUNTER(cache->counter);
+            }
         }
         opcode = original_opcode;
         DISPATCH_GOTO();
@@ -308,4 +308,147 @@ monitoring__all_events(PyObject *module, PyObject *Py_UNUSED(ignored))
 {
     return monitoring__all_events_impl(module);
 }
-/*[clinic end generated code: output=11cc0803875b3ffa input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(monitoring_start_coverage__doc__,
+"start_coverage($module, tool_id, event_set, /, dump_path=None)\n"
+"--\n"
+"\n"
+"Collect coverage for LINE and BRANCH events natively.\n"
+"\n"
+"Events in event_set are recorded without calling the tool\'s callbacks,\n"
+"and are disabled once recorded. Any previously collected coverage is\n"
+"discarded, and the events disabled for tool_id are restarted.\n"
+"\n"
+"If dump_path is given, the coverage is written to it at exit, as if by\n"
+"dump_coverage(). Only the dump_path of the latest call is used.");
+
+#define MONITORING_START_COVERAGE_METHODDEF    \
+    {"start_coverage", _PyCFunction_CAST(monitoring_start_coverage), METH_FASTCALL|METH_KEYWORDS, monitoring_start_coverage__doc__},
+
+static PyObject *
+monitoring_start_coverage_impl(PyObject *module, int tool_id, int event_set,
+                               PyObject *dump_path);
+
+static PyObject *
+monitoring_start_coverage(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(dump_path), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"", "", "dump_path", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "start_coverage",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[3];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
+    int tool_id;
+    int event_set;
+    PyObject *dump_path = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 2, 3, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    tool_id = _PyLong_AsInt(args[0]);
+    if (tool_id == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    event_set = _PyLong_AsInt(args[1]);
+    if (event_set == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    dump_path = args[2];
+skip_optional_pos:
+    return_value = monitoring_start_coverage_impl(module, tool_id, event_set, dump_path);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(monitoring_stop_coverage__doc__,
+"stop_coverage($module, tool_id, /)\n"
+"--\n"
+"\n"
+"Stop collecting coverage, keeping the data collected so far.");
+
+#define MONITORING_STOP_COVERAGE_METHODDEF    \
+    {"stop_coverage", (PyCFunction)monitoring_stop_coverage, METH_O, monitoring_stop_coverage__doc__},
+
+static PyObject *
+monitoring_stop_coverage_impl(PyObject *module, int tool_id);
+
+static PyObject *
+monitoring_stop_coverage(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int tool_id;
+
+    tool_id = _PyLong_AsInt(arg);
+    if (tool_id == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = monitoring_stop_coverage_impl(module, tool_id);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(monitoring_get_coverage__doc__,
+"get_coverage($module, /)\n"
+"--\n"
+"\n"
+"Return the collected coverage as a list of records.\n"
+"\n"
+"Each record is a (filename, qualname, firstlineno, bitmap) tuple, for\n"
+"the code object with these co_filename, co_qualname and co_firstlineno.\n"
+"Code objects that were freed are included, and the coverage of code\n"
+"objects with the same identity and size is merged.\n"
+"\n"
+"bitmap is made of three bitmaps of (n + 7) // 8 bytes each, where n is\n"
+"the number of code units of the code: the lines executed, the branches\n"
+"not taken and the branches taken.  Code unit k (at instruction offset\n"
+"2 * k) is bit k % 8 of byte k // 8 of each of them.");
+
+#define MONITORING_GET_COVERAGE_METHODDEF    \
+    {"get_coverage", (PyCFunction)monitoring_get_coverage, METH_NOARGS, monitoring_get_coverage__doc__},
+
+static PyObject *
+monitoring_get_coverage_impl(PyObject *module);
+
+static PyObject *
+monitoring_get_coverage(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return monitoring_get_coverage_impl(module);
+}
+
+PyDoc_STRVAR(monitoring_dump_coverage__doc__,
+"dump_coverage($module, path, /)\n"
+"--\n"
+"\n"
+"Write the result of get_coverage() to path, in marshal format.");
+
+#define MONITORING_DUMP_COVERAGE_METHODDEF    \
+    {"dump_coverage", (PyCFunction)monitoring_dump_coverage, METH_O, monitoring_dump_coverage__doc__},
+/*[clinic end generated code: output=b38c49cf9d42ecb2 input=a9049054013a1b77]*/
@@ -2166,6 +2166,300 @@ _Py_dg_freedtoa(char *s)
     Bfree(b);
 }
 
+/* Shortest round-trip digits via Grisu3: see Florian Loitsch, "Printing
+ * Floating-Point Numbers Quickly and Accurately with Integers" [Proc. ACM
+ * PLDI '10, pp. 233-243].  This follows the structure of the Grisu3
+ * implementation in the double-conversion library.
+ *
+ * Grisu3 uses only 64-bit integer arithmetic.  For about 99.5% of doubles
+ * it produces the shortest digit string that rounds to d, choosing the one
+ * closest to d when there are several: exactly what mode 0 of _Py_dg_dtoa
+ * produces.  For the remainder it cannot guarantee that and gives up, and
+ * _Py_dg_dtoa falls back to the Bigint-based algorithm.
+ */
+
+typedef struct {
+    ULLong f;
+    int e;
+} DiyFp;                        /* f * 2**e */
+
+/* Normalized approximations of 10**k, rounded to nearest, for
+   k = -348, -340, ..., 340: 10**k ~= f * 2**e. */
+static const struct {
+    ULLong f;
+    short e;
+    short k;
+} grisu_cached_powers[] = {
+    {0xfa8fd5a0081c0288ULL, -1220, -348},
+    {0xbaaee17fa23ebf76ULL, -1193, -340},
+    {0x8b16fb203055ac76ULL, -1166, -332},
+    {0xcf42894a5dce35eaULL, -1140, -324},
+    {0x9a6bb0aa55653b2dULL, -1113, -316},
+    {0xe61acf033d1a45dfULL, -1087, -308},
+    {0xab70fe17c79ac6caULL, -1060, -300},
+    {0xff77b1fcbebcdc4fULL, -1034, -292},
+    {0xbe5691ef416bd60cULL, -1007, -284},
+    {0x8dd01fad907ffc3cULL, -980, -276},
+    {0xd3515c2831559a83ULL, -954, -268},
+    {0x9d71ac8fada6c9b5ULL, -927, -260},
+    {0xea9c227723ee8bcbULL, -901, -252},
+    {0xaecc49914078536dULL, -874, -244},
+    {0x823c12795db6ce57ULL, -847, -236},
+    {0xc21094364dfb5637ULL, -821, -228},
+    {0x9096ea6f3848984fULL, -794, -220},
+    {0xd77485cb25823ac7ULL, -768, -212},
+    {0xa086cfcd97bf97f4ULL, -741, -204},
+    {0xef340a98172aace5ULL, -715, -196},
+    {0xb23867fb2a35b28eULL, -688, -188},
+    {0x84c8d4dfd2c63f3bULL, -661, -180},
+    {0xc5dd44271ad3cdbaULL, -635, -172},
+    {0x936b9fcebb25c996ULL, -608, -164},
+    {0xdbac6c247d62a584ULL, -582, -156},
+    {0xa3ab66580d5fdaf6ULL, -555, -148},
+    {0xf3e2f893dec3f126ULL, -529, -140},
+    {0xb5b5ada8aaff80b8ULL, -502, -132},
+    {0x87625f056c7c4a8bULL, -475, -124},
+    {0xc9bcff6034c13053ULL, -449, -116},
+    {0x964e858c91ba2655ULL, -422, -108},
+    {0xdff9772470297ebdULL, -396, -100},
+    {0xa6dfbd9fb8e5b88fULL, -369, -92},
+    {0xf8a95fcf88747d94ULL, -343, -84},
+    {0xb94470938fa89bcfULL, -316, -76},
+    {0x8a08f0f8bf0f156bULL, -289, -68},
+    {0xcdb02555653131b6ULL, -263, -60},
+    {0x993fe2c6d07b7facULL, -236, -52},
+    {0xe45c10c42a2b3b06ULL, -210, -44},
+    {0xaa242499697392d3ULL, -183, -36},
+    {0xfd87b5f28300ca0eULL, -157, -28},
+    {0xbce5086492111aebULL, -130, -20},
+    {0x8cbccc096f5088ccULL, -103, -12},
+    {0xd1b71758e219652cULL, -77, -4},
+    {0x9c40000000000000ULL, -50, 4},
+    {0xe8d4a51000000000ULL, -24, 12},
+    {0xad78ebc5ac620000ULL, 3, 20},
+    {0x813f3978f8940984ULL, 30, 28},
+    {0xc097ce7bc90715b3ULL, 56, 36},
+    {0x8f7e32ce7bea5c70ULL, 83, 44},
+    {0xd5d238a4abe98068ULL, 109, 52},
+    {0x9f4f2726179a2245ULL, 136, 60},
+    {0xed63a231d4c4fb27ULL, 162, 68},
+    {0xb0de65388cc8ada8ULL, 189, 76},
+    {0x83c7088e1aab65dbULL, 216, 84},
+    {0xc45d1df942711d9aULL, 242, 92},
+    {0x924d692ca61be758ULL, 269, 100},
+    {0xda01ee641a708deaULL, 295, 108},
+    {0xa26da3999aef774aULL, 322, 116},
+    {0xf209787bb47d6b85ULL, 348, 124},
+    {0xb454e4a179dd1877ULL, 375, 132},
+    {0x865b86925b9bc5c2ULL, 402, 140},
+    {0xc83553c5c8965d3dULL, 428, 148},
+    {0x952ab45cfa97a0b3ULL, 455, 156},
+    {0xde469fbd99a05fe3ULL, 481, 164},
+    {0xa59bc234db398c25ULL, 508, 172},
+    {0xf6c69a72a3989f5cULL, 534, 180},
+    {0xb7dcbf5354e9beceULL, 561, 188},
+    {0x88fcf317f22241e2ULL, 588, 196},
+    {0xcc20ce9bd35c78a5ULL, 614, 204},
+    {0x98165af37b2153dfULL, 641, 212},
+    {0xe2a0b5dc971f303aULL, 667, 220},
+    {0xa8d9d1535ce3b396ULL, 694, 228},
+    {0xfb9b7cd9a4a7443cULL, 720, 236},
+    {0xbb764c4ca7a44410ULL, 747, 244},
+    {0x8bab8eefb6409c1aULL, 774, 252},
+    {0xd01fef10a657842cULL, 800, 260},
+    {0x9b10a4e5e9913129ULL, 827, 268},
+    {0xe7109bfba19c0c9dULL, 853, 276},
+    {0xac2820d9623bf429ULL, 880, 284},
+    {0x80444b5e7aa7cf85ULL, 907, 292},
+    {0xbf21e44003acdd2dULL, 933, 300},
+    {0x8e679c2f5e44ff8fULL, 960, 308},
+    {0xd433179d9c8cb841ULL, 986, 316},
+    {0x9e19db92b4e31ba9ULL, 1013, 324},
+    {0xeb96bf6ebadf77d9ULL, 1039, 332},
+    {0xaf87023b9bf0ee6bULL, 1066, 340},
+};
+
+#define GRISU_CACHED_POWERS_OFFSET 348  /* -k of the first cached power */
+#define GRISU_CACHED_POWERS_STEP 8      /* distance between cached k */
+#define GRISU_MIN_TARGET_EXP (-60)
+#define GRISU_MAX_TARGET_EXP (-32)
+#define GRISU_BUFFER_SIZE 18            /* at most 17 digits are needed */
+
+static DiyFp
+diyfp_normalize(DiyFp x)
+{
+    while (!(x.f & 0xFFC0000000000000ULL)) {
+        x.f <<= 10;
+        x.e -= 10;
+    }
+    while (!(x.f & 0x8000000000000000ULL)) {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+/* Return x * y, with the 128-bit product rounded to its top 64 bits. */
+static DiyFp
+diyfp_multiply(DiyFp x, DiyFp y)
+{
+    const ULLong M32 = 0xFFFFFFFFULL;
+    ULLong a = x.f >> 32, b = x.f & M32, c = y.f >> 32, d = y.f & M32;
+    ULLong ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    ULLong tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+    DiyFp r;
+    tmp += 1ULL << 31;          /* round */
+    r.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+    r.e = x.e + y.e + 64;
+    return r;
+}
+
+/* Weed out candidates that are not guaranteed to be the closest shortest
+   representation, adjusting the last digit of buffer towards w.  All
+   distances are in units of the scaled input; see Loitsch's paper for the
+   reasoning behind each test. */
+static int
+grisu_round_weed(char *buffer, int length, ULLong distance_too_high_w,
+                 ULLong unsafe_interval, ULLong rest, ULLong ten_kappa,
+                 ULLong unit)
+{
+    ULLong small_distance = distance_too_high_w - unit;
+    ULLong big_distance = distance_too_high_w + unit;
+
+    while (rest < small_distance &&
+           unsafe_interval - rest >= ten_kappa &&
+           (rest + ten_kappa < small_distance ||
+            small_distance - rest >= rest + ten_kappa - small_distance)) {
+        buffer[length - 1]--;
+        rest += ten_kappa;
+    }
+    if (rest < big_distance &&
+        unsafe_interval - rest >= ten_kappa &&
+        (rest + ten_kappa < big_distance ||
+         big_distance - rest > rest + ten_kappa - big_distance)) {
+        return 0;
+    }
+    return (2 * unit <= rest) && (rest <= unsafe_interval - 4 * unit);
+}
+
+/* Generate the shortest digits of w that lie within (low, high), the
+   scaled boundaries of the input.  The digits d1...dn in buffer represent
+   d1...dn * 10**kappa. */
+static int
+grisu_digit_gen(DiyFp low, DiyFp w, DiyFp high,
+                char *buffer, int *length, int *kappa)
+{
+    ULLong unit = 1;
+    DiyFp too_low = {low.f - unit, low.e};
+    DiyFp too_high = {high.f + unit, high.e};
+    ULLong unsafe_interval = too_high.f - too_low.f;
+    int shift = -w.e;
+    ULLong one = 1ULL << shift;
+    ULong integrals = (ULong)(too_high.f >> shift);
+    ULLong fractionals = too_high.f & (one - 1);
+    ULong divisor = 1000000000;
+    int k = 10;
+
+    /* integrals < 2**32, and it is non-zero since too_high is normalized
+       and shift <= 60. */
+    while (divisor > integrals) {
+        divisor /= 10;
+        k--;
+    }
+    *length = 0;
+    while (k > 0) {
+        ULLong rest;
+        buffer[(*length)++] = (char)('0' + integrals / divisor);
+        integrals %= divisor;
+        k--;
+        rest = ((ULLong)integrals << shift) + fractionals;
+        if (rest < unsafe_interval) {
+            *kappa = k;
+            return grisu_round_weed(buffer, *length, too_high.f - w.f,
+                                    unsafe_interval, rest,
+                                    (ULLong)divisor << shift, unit);
+        }
+        divisor /= 10;
+    }
+    for (;;) {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe_interval *= 10;
+        buffer[(*length)++] = (char)('0' + (fractionals >> shift));
+        fractionals &= one - 1;
+        k--;
+        if (fractionals < unsafe_interval) {
+            *kappa = k;
+            return grisu_round_weed(buffer, *length,
+                                    (too_high.f - w.f) * unit,
+                                    unsafe_interval, fractionals, one, unit);
+        }
+        if (*length >= GRISU_BUFFER_SIZE - 1) {
+            return 0;
+        }
+    }
+}
+
+/* Try to compute the digits of mode 0 for the positive, finite, non-zero
+   double d.  On success, return 1 and store the digits (without trailing
+   zeros) in buffer[0:*length] and the decimal point position in *decpt.
+   Return 0 if Grisu3 cannot guarantee the result. */
+static int
+grisu3(U *d, char *buffer, int *length, int *decpt)
+{
+    DiyFp v, w, m_plus, m_minus, c;
+    int biased_e, min_exp, k, index, kappa;
+    int lower_boundary_is_closer;
+
+    biased_e = (int)((word0(d) & Exp_mask) >> Exp_shift);
+    v.f = ((ULLong)(word0(d) & Frac_mask) << 32) | word1(d);
+    if (biased_e) {
+        v.f |= 1ULL << (P - 1);
+        v.e = biased_e - Bias - (P - 1);
+    }
+    else {
+        v.e = Emin - (P - 1);
+    }
+    lower_boundary_is_closer = (v.f == 1ULL << (P - 1) && biased_e > 1);
+
+    w = diyfp_normalize(v);
+
+    /* The boundaries m- and m+ are halfway to the neighbouring doubles. */
+    m_plus.f = (v.f << 1) + 1;
+    m_plus.e = v.e - 1;
+    m_plus = diyfp_normalize(m_plus);
+    if (lower_boundary_is_closer) {
+        m_minus.f = (v.f << 2) - 1;
+        m_minus.e = v.e - 2;
+    }
+    else {
+        m_minus.f = (v.f << 1) - 1;
+        m_minus.e = v.e - 1;
+    }
+    m_minus.f <<= m_minus.e - m_plus.e;
+    m_minus.e = m_plus.e;
+
+    /* Pick a cached power of ten c such that w * c has its binary exponent
+       in [GRISU_MIN_TARGET_EXP, GRISU_MAX_TARGET_EXP]. */
+    min_exp = GRISU_MIN_TARGET_EXP - (w.e + 64);
+    k = (int)ceil((min_exp + 63) * 0.30102999566398114);
+    index = (GRISU_CACHED_POWERS_OFFSET + k - 1) / GRISU_CACHED_POWERS_STEP + 1;
+    c.f = grisu_cached_powers[index].f;
+    c.e = grisu_cached_powers[index].e;
+    assert(min_exp <= c.e);
+    assert(c.e <= GRISU_MAX_TARGET_EXP - (w.e + 64));
+
+    if (!grisu_digit_gen(diyfp_multiply(m_minus, c), diyfp_multiply(w, c),
+                         diyfp_multiply(m_plus, c), buffer, length, &kappa)) {
+        return 0;
+    }
+    *decpt = *length + kappa - grisu_cached_powers[index].k;
+    while (*length > 1 && buffer[*length - 1] == '0') {
+        (*length)--;
+    }
+    return 1;
+}
+
 /* dtoa for IEEE arithmetic (dmg): convert double to ASCII string.
  *
  * Inspired by "How to Print Floating-Point Numbers Accurately" by
@@ -2281,6 +2575,22 @@ _Py_dg_dtoa(double dd, int mode, int ndigits,
         return nrv_alloc("0", rve, 1);
     }
 
+    /* Try Grisu3 first for the shortest representation. */
+    if (mode == 0) {
+        char buffer[GRISU_BUFFER_SIZE];
+        int length;
+        if (grisu3(&u, buffer, &length, decpt)) {
+            s0 = rv_alloc(length);
+            if (s0 == NULL)
+                return NULL;
+            memcpy(s0, buffer, length);
+            s0[length] = '\0';
+            if (rve)
+                *rve = s0 + length;
+            return s0;
+        }
+    }
+
     /* compute k = floor(log10(d)).  The computation may leave k
        one too large, but should never leave k too small. */
     b = d2b(&u, &be, &bbits);
@@ -5,6 +5,7 @@
 #include "Python.h"
 #include "pycore_call.h"
 #include "pycore_frame.h"
+#include "pycore_import.h"
 #include "pycore_interp.h"
 #include "pycore_long.h"
 #include "pycore_namespace.h"
@@ -12,6 +13,7 @@
 #include "pycore_opcode.h"
 #include "pycore_pyerrors.h"
 #include "pycore_pystate.h"
+#include "marshal.h"
 
 /* Uncomment this to dump debugging output when assertions fail */
 // #define INSTRUMENT_DEBUG 1
@@ -483,7 +485,8 @@ sanity_check_instrumentation(PyCodeObject *code)
             CHECK(opcode != RESUME_CHECK);
             CHECK(opcode != INSTRUMENTED_RESUME);
             if (!is_instrumented(opcode)) {
-                CHECK(_PyOpcode_Deopt[opcode] == opcode);
+                CHECK(_PyOpcode_Deopt[opcode] == opcode ||
+                      _PyOpcode_Caches[_PyOpcode_Deopt[opcode]]);
             }
             CHECK(opcode != INSTRUMENTED_LINE);
         }
@@ -598,9 +601,12 @@ de_instrument_line(PyCodeObject *code, int i)
         lines->original_opcode = code->_co_monitoring->per_instruction_opcodes[i];
     }
     CHECK(original_opcode != 0);
-    CHECK(original_opcode == _PyOpcode_Deopt[original_opcode]);
     instr->op.code = original_opcode;
-    if (_PyOpcode_Caches[original_opcode]) {
+    /* A specialized instruction keeps its specialization (and counter),
+     * so turning line events off does not require a new warm up. */
+    if (_PyOpcode_Caches[original_opcode] &&
+        original_opcode == _PyOpcode_Deopt[original_opcode])
+    {
         instr[1].cache = adaptive_counter_warmup();
     }
     assert(instr->op.code != INSTRUMENTED_LINE);
@@ -671,7 +677,11 @@ instrument_line(PyCodeObject *code, int i)
         return;
     }
     _PyCoLineInstrumentationData *lines = &code->_co_monitoring->lines[i];
-    lines->original_opcode = _PyOpcode_Deopt[opcode];
+    /* Keep specialized instructions, so that line events do not slow down
+     * the code in between them. Super-instructions must be split, as they
+     * would skip the line event of the instruction they absorb. */
+    int deopt = _PyOpcode_Deopt[opcode];
+    lines->original_opcode = _PyOpcode_Caches[deopt] ? opcode : deopt;
     CHECK(lines->original_opcode > 0);
     *opcode_ptr = INSTRUMENTED_LINE;
 }
@@ -860,6 +870,120 @@ call_one_instrument(
     return (res == &_PyInstrumentation_DISABLE);
 }
 
+/* Native coverage collection.
+ * Instead of calling a Python callback, LINE and BRANCH events for the
+ * coverage tool set a bit in a per-code-object bitmap with one bit per
+ * code unit, and then disable themselves.
+ * A branch is only disabled once both of its directions have been seen.
+ * The data does not keep its code object alive: when the code object is
+ * freed, the data is kept without it (see _PyCoCoverageData). */
+
+/* Bitmaps of _PyCoCoverageData, in order */
+#define COVERAGE_LINE 0
+#define COVERAGE_BRANCH_NOT_TAKEN 1
+#define COVERAGE_BRANCH_TAKEN 2
+#define COVERAGE_BITMAPS 3
+
+static inline void
+set_coverage_bit(_PyCoCoverageData *coverage, int bitmap, int offset)
+{
+    coverage->bitmaps[bitmap * coverage->size + (offset >> 3)] |=
+        (uint8_t)(1 << (offset & 7));
+}
+
+static inline int
+get_coverage_bit(_PyCoCoverageData *coverage, int bitmap, int offset)
+{
+    return (coverage->bitmaps[bitmap * coverage->size + (offset >> 3)] >>
+            (offset & 7)) & 1;
+}
+
+static _PyCoCoverageData *
+get_coverage_data(PyInterpreterState *interp, PyCodeObject *code)
+{
+    _PyCoMonitoringData *data = code->_co_monitoring;
+    assert(data != NULL);
+    if (data->coverage == NULL) {
+        Py_ssize_t size = (Py_SIZE(code) + 7) / 8;
+        _PyCoCoverageData *coverage = PyMem_Calloc(
+            1, offsetof(_PyCoCoverageData, bitmaps) + COVERAGE_BITMAPS * size);
+        if (coverage == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        coverage->code = code;
+        coverage->filename = Py_NewRef(code->co_filename);
+        coverage->qualname = Py_NewRef(code->co_qualname);
+        coverage->firstlineno = code->co_firstlineno;
+        coverage->size = size;
+        coverage->next = interp->monitoring_coverage_data;
+        if (coverage->next != NULL) {
+            coverage->next->pprev = &coverage->next;
+        }
+        coverage->pprev = &interp->monitoring_coverage_data;
+        interp->monitoring_coverage_data = coverage;
+        data->coverage = coverage;
+    }
+    return data->coverage;
+}
+
+void
+_PyMonitoring_DetachCoverageData(_PyCoCoverageData *coverage)
+{
+    coverage->code = NULL;
+}
+
+void
+_PyMonitoring_ClearCoverage(PyInterpreterState *interp)
+{
+    while (interp->monitoring_coverage_data != NULL) {
+        _PyCoCoverageData *coverage = interp->monitoring_coverage_data;
+        if (coverage->code != NULL) {
+            coverage->code->_co_monitoring->coverage = NULL;
+        }
+        interp->monitoring_coverage_data = coverage->next;
+        Py_DECREF(coverage->filename);
+        Py_DECREF(coverage->qualname);
+        PyMem_Free(coverage);
+    }
+}
+
+/* Return 1 (DISABLE), or -1 if error */
+static int
+record_line_coverage(PyInterpreterState *interp, PyCodeObject *code, int offset)
+{
+    _PyCoCoverageData *coverage = get_coverage_data(interp, code);
+    if (coverage == NULL) {
+        return -1;
+    }
+    set_coverage_bit(coverage, COVERAGE_LINE, offset);
+    return 1;
+}
+
+/* Return 1 if DISABLE, -1 if error, 0 otherwise */
+static int
+record_branch_coverage(PyInterpreterState *interp, PyCodeObject *code,
+                       int offset, PyObject *destination)
+{
+    _PyCoCoverageData *coverage = get_coverage_data(interp, code);
+    if (coverage == NULL) {
+        return -1;
+    }
+    Py_ssize_t dest = PyLong_AsSsize_t(destination);
+    if (dest == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    int fallthrough = offset + instruction_length(code, offset);
+    if (dest == fallthrough * (Py_ssize_t)sizeof(_Py_CODEUNIT)) {
+        set_coverage_bit(coverage, COVERAGE_BRANCH_NOT_TAKEN, offset);
+    }
+    else {
+        set_coverage_bit(coverage, COVERAGE_BRANCH_TAKEN, offset);
+    }
+    return (get_coverage_bit(coverage, COVERAGE_BRANCH_NOT_TAKEN, offset) &&
+            get_coverage_bit(coverage, COVERAGE_BRANCH_TAKEN, offset));
+}
+
 static const int8_t MOST_SIGNIFICANT_BITS[16] = {
     -1, 0, 1, 1,
     2, 2, 2, 2,
@@ -978,7 +1102,15 @@ call_instrumentation_vector(
         assert(tool >= 0 && tool < 8);
         assert(tools & (1 << tool));
         tools ^= (1 << tool);
-        int res = call_one_instrument(interp, tstate, callargs, nargsf, tool, event);
+        int res;
+        if (tool == interp->monitoring_coverage_tool &&
+            event == PY_MONITORING_EVENT_BRANCH)
+        {
+            res = record_branch_coverage(interp, code, offset, args[3]);
+        }
+        else {
+            res = call_one_instrument(interp, tstate, callargs, nargsf, tool, event);
+        }
         if (res == 0) {
             /* Nothing to do */
         }
@@ -1141,25 +1273,36 @@ _Py_call_instrumentation_line(PyThreadState *tstate, _PyInterpreterFrame* frame,
         (interp->monitors.tools[PY_MONITORING_EVENT_LINE] |
          code->_co_monitoring->local_monitors.tools[PY_MONITORING_EVENT_LINE]
         );
-    PyObject *line_obj = PyLong_FromSsize_t(line);
-    if (line_obj == NULL) {
-        return -1;
-    }
-    PyObject *args[3] = { NULL, (PyObject *)code, line_obj };
+    /* Created lazily, as the coverage tool does not need it */
+    PyObject *line_obj = NULL;
+    PyObject *args[3] = { NULL, (PyObject *)code, NULL };
     while (tools) {
         int tool = most_significant_bit(tools);
         assert(tool >= 0 && tool < 8);
         assert(tools & (1 << tool));
         tools &= ~(1 << tool);
-        int res = call_one_instrument(interp, tstate, &args[1],
-                                      2 | PY_VECTORCALL_ARGUMENTS_OFFSET,
-                                      tool, PY_MONITORING_EVENT_LINE);
+        int res;
+        if (tool == interp->monitoring_coverage_tool) {
+            res = record_line_coverage(interp, code, i);
+        }
+        else {
+            if (line_obj == NULL) {
+                line_obj = PyLong_FromSsize_t(line);
+                if (line_obj == NULL) {
+                    return -1;
+                }
+                args[2] = line_obj;
+            }
+            res = call_one_instrument(interp, tstate, &args[1],
+                                          2 | PY_VECTORCALL_ARGUMENTS_OFFSET,
+                                          tool, PY_MONITORING_EVENT_LINE);
+        }
         if (res == 0) {
             /* Nothing to do */
         }
         else if (res < 0) {
             /* error */
-            Py_DECREF(line_obj);
+            Py_XDECREF(line_obj);
             return -1;
         }
         else {
@@ -1167,13 +1310,12 @@ _Py_call_instrumentation_line(PyThreadState *tstate, _PyInterpreterFrame* frame,
             remove_line_tools(code, i, 1 << tool);
         }
     }
-    Py_DECREF(line_obj);
+    Py_XDECREF(line_obj);
     uint8_t original_opcode;
 done:
     original_opcode = line_data->original_opcode;
     assert(original_opcode != 0);
     assert(original_opcode < INSTRUMENTED_LINE);
-    assert(_PyOpcode_Deopt[original_opcode] == original_opcode);
     return original_opcode;
 }
 
@@ -1440,6 +1582,7 @@ allocate_instrumentation_data(PyCodeObject *code)
         code->_co_monitoring->line_tools = NULL;
         code->_co_monitoring->per_instruction_opcodes = NULL;
         code->_co_monitoring->per_instruction_tools = NULL;
+        code->_co_monitoring->coverage = NULL;
     }
     return 0;
 }
@@ -1561,6 +1704,17 @@ _Py_Instrument(PyCodeObject *code, PyInterpreterState *interp)
         removed_events = monitors_sub(code->_co_monitoring->active_monitors, active_events);
         new_events = monitors_sub(active_events, code->_co_monitoring->active_monitors);
         assert(monitors_are_empty(monitors_and(new_events, removed_events)));
+        int tool = interp->monitoring_coverage_tool;
+        if (tool >= 0 &&
+            interp->monitoring_coverage_restart_version > code->_co_instrumentation_version)
+        {
+            /* Restart the events disabled by the coverage tool only */
+            for (int e = 0; e < _PY_MONITORING_LOCAL_EVENTS; e++) {
+                removed_events.tools[e] |=
+                    code->_co_monitoring->active_monitors.tools[e] & (1 << tool);
+                new_events.tools[e] |= active_events.tools[e] & (1 << tool);
+            }
+        }
     }
     code->_co_monitoring->active_monitors = active_events;
     code->_co_instrumentation_version = interp->monitoring_version;
@@ -1845,6 +1999,9 @@ monitoring_free_tool_id_impl(PyObject *module, int tool_id)
     }
     PyInterpreterState *interp = _PyInterpreterState_Get();
     Py_CLEAR(interp->monitoring_tool_names[tool_id]);
+    if (interp->monitoring_coverage_tool == tool_id) {
+        interp->monitoring_coverage_tool = -1;
+    }
     Py_RETURN_NONE;
 }
 
@@ -2106,6 +2263,293 @@ monitoring__all_events_impl(PyObject *module)
     return res;
 }
 
+#define COVERAGE_EVENTS \
+    ((1 << PY_MONITORING_EVENT_LINE) | (1 << PY_MONITORING_EVENT_BRANCH))
+
+static PyObject *monitoring_dump_coverage(PyObject *module, PyObject *path);
+
+/* Registered with atexit once per interpreter, by start_coverage() */
+static PyObject *
+dump_coverage_at_exit(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyInterpreterState *interp = _PyInterpreterState_Get();
+    if (interp->monitoring_coverage_dump_path == NULL) {
+        Py_RETURN_NONE;
+    }
+    PyObject *path = Py_NewRef(interp->monitoring_coverage_dump_path);
+    PyObject *res = monitoring_dump_coverage(NULL, path);
+    Py_DECREF(path);
+    return res;
+}
+
+static PyMethodDef dump_coverage_at_exit_def = {
+    "dump_coverage_at_exit", dump_coverage_at_exit, METH_NOARGS, NULL
+};
+
+/*[clinic input]
+monitoring.start_coverage
+
+    tool_id: int
+    event_set: int
+    /
+    dump_path: object = None
+
+Collect coverage for LINE and BRANCH events natively.
+
+Events in event_set are recorded without calling the tool's callbacks,
+and are disabled once recorded. Any previously collected coverage is
+discarded, and the events disabled for tool_id are restarted.
+
+If dump_path is given, the coverage is written to it at exit, as if by
+dump_coverage(). Only the dump_path of the latest call is used.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_start_coverage_impl(PyObject *module, int tool_id, int event_set,
+                               PyObject *dump_path)
+/*[clinic end generated code: output=bcc4d28448ec6875 input=e154856b590e18a0]*/
+{
+    if (check_valid_tool(tool_id))  {
+        return NULL;
+    }
+    if (event_set == 0 || (event_set & ~COVERAGE_EVENTS)) {
+        PyErr_Format(PyExc_ValueError,
+                     "invalid coverage event set 0x%x "
+                     "(must be LINE, BRANCH or both)", event_set);
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_Get();
+    if (interp->monitoring_coverage_tool >= 0 &&
+        interp->monitoring_coverage_tool != tool_id)
+    {
+        PyErr_Format(PyExc_ValueError,
+                     "tool %d is already collecting coverage",
+                     interp->monitoring_coverage_tool);
+        return NULL;
+    }
+    if (dump_path != Py_None && !interp->monitoring_coverage_dump_registered) {
+        PyObject *dump = PyCFunction_New(&dump_coverage_at_exit_def, NULL);
+        if (dump == NULL) {
+            return NULL;
+        }
+        PyObject *res = _PyImport_GetModuleAttrString("atexit", "register");
+        if (res != NULL) {
+            Py_SETREF(res, PyObject_CallOneArg(res, dump));
+        }
+        Py_DECREF(dump);
+        if (res == NULL) {
+            return NULL;
+        }
+        Py_DECREF(res);
+        interp->monitoring_coverage_dump_registered = 1;
+    }
+    Py_XSETREF(interp->monitoring_coverage_dump_path,
+               dump_path == Py_None ? NULL : Py_NewRef(dump_path));
+    _PyMonitoring_ClearCoverage(interp);
+    interp->monitoring_coverage_tool = tool_id;
+    /* Like restart_events(), but only for the coverage tool;
+       see _Py_Instrument() */
+    interp->monitoring_coverage_restart_version = interp->monitoring_version + 1;
+    interp->monitoring_version = interp->monitoring_coverage_restart_version + 1;
+    if (_PyMonitoring_SetEvents(tool_id, event_set) ||
+        instrument_all_executing_code_objects(interp))
+    {
+        interp->monitoring_coverage_tool = -1;
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+monitoring.stop_coverage
+
+    tool_id: int
+    /
+
+Stop collecting coverage, keeping the data collected so far.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_stop_coverage_impl(PyObject *module, int tool_id)
+/*[clinic end generated code: output=80cf9c4bc0845824 input=78553e233f251818]*/
+{
+    if (check_valid_tool(tool_id))  {
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_Get();
+    if (interp->monitoring_coverage_tool != tool_id) {
+        PyErr_Format(PyExc_ValueError,
+                     "tool %d is not collecting coverage", tool_id);
+        return NULL;
+    }
+    if (_PyMonitoring_SetEvents(tool_id, 0)) {
+        return NULL;
+    }
+    interp->monitoring_coverage_tool = -1;
+    Py_RETURN_NONE;
+}
+
+static void
+free_coverage_copies(_PyCoCoverageData *copies)
+{
+    while (copies != NULL) {
+        _PyCoCoverageData *next = copies->next;
+        Py_DECREF(copies->filename);
+        Py_DECREF(copies->qualname);
+        PyMem_Free(copies);
+        copies = next;
+    }
+}
+
+/*[clinic input]
+monitoring.get_coverage
+
+Return the collected coverage as a list of records.
+
+Each record is a (filename, qualname, firstlineno, bitmap) tuple, for
+the code object with these co_filename, co_qualname and co_firstlineno.
+Code objects that were freed are included, and the coverage of code
+objects with the same identity and size is merged.
+
+bitmap is made of three bitmaps of (n + 7) // 8 bytes each, where n is
+the number of code units of the code: the lines executed, the branches
+not taken and the branches taken.  Code unit k (at instruction offset
+2 * k) is bit k % 8 of byte k // 8 of each of them.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_get_coverage_impl(PyObject *module)
+/*[clinic end generated code: output=44525fc02f83d9da input=45a26129cb568970]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_Get();
+    /* Copy the data first, as the allocations below may run the GC, and
+       a finalizer may restart the coverage, which frees the data.
+       PyMem_Malloc() does not run the GC. */
+    _PyCoCoverageData *copies = NULL;
+    for (_PyCoCoverageData *coverage = interp->monitoring_coverage_data;
+         coverage != NULL; coverage = coverage->next)
+    {
+        size_t size = offsetof(_PyCoCoverageData, bitmaps) +
+                      COVERAGE_BITMAPS * coverage->size;
+        _PyCoCoverageData *copy = PyMem_Malloc(size);
+        if (copy == NULL) {
+            free_coverage_copies(copies);
+            return PyErr_NoMemory();
+        }
+        memcpy(copy, coverage, size);
+        copy->code = NULL;
+        Py_INCREF(copy->filename);
+        Py_INCREF(copy->qualname);
+        /* Oldest first */
+        copy->next = copies;
+        copies = copy;
+    }
+
+    /* (filename, qualname, firstlineno, size) -> bytearray */
+    PyObject *merged = PyDict_New();
+    PyObject *res = NULL;
+    if (merged == NULL) {
+        goto done;
+    }
+    for (_PyCoCoverageData *copy = copies; copy != NULL; copy = copy->next) {
+        PyObject *key = Py_BuildValue("(OOin)", copy->filename,
+                                      copy->qualname, copy->firstlineno,
+                                      copy->size);
+        if (key == NULL) {
+            goto done;
+        }
+        Py_ssize_t size = COVERAGE_BITMAPS * copy->size;
+        PyObject *bitmap = PyDict_GetItemWithError(merged, key);
+        if (bitmap != NULL) {
+            uint8_t *bits = (uint8_t *)PyByteArray_AS_STRING(bitmap);
+            for (Py_ssize_t i = 0; i < size; i++) {
+                bits[i] |= copy->bitmaps[i];
+            }
+            Py_DECREF(key);
+            continue;
+        }
+        if (PyErr_Occurred()) {
+            Py_DECREF(key);
+            goto done;
+        }
+        bitmap = PyByteArray_FromStringAndSize(
+            (const char *)copy->bitmaps, size);
+        if (bitmap == NULL) {
+            Py_DECREF(key);
+            goto done;
+        }
+        int err = PyDict_SetItem(merged, key, bitmap);
+        Py_DECREF(key);
+        Py_DECREF(bitmap);
+        if (err) {
+            goto done;
+        }
+    }
+
+    res = PyList_New(0);
+    if (res == NULL) {
+        goto done;
+    }
+    Py_ssize_t pos = 0;
+    PyObject *key, *bitmap;
+    while (PyDict_Next(merged, &pos, &key, &bitmap)) {
+        PyObject *item = Py_BuildValue(
+            "(OOON)", PyTuple_GET_ITEM(key, 0), PyTuple_GET_ITEM(key, 1),
+            PyTuple_GET_ITEM(key, 2),
+            PyBytes_FromStringAndSize(PyByteArray_AS_STRING(bitmap),
+                                      PyByteArray_GET_SIZE(bitmap)));
+        if (item == NULL || PyList_Append(res, item)) {
+            Py_XDECREF(item);
+            Py_CLEAR(res);
+            goto done;
+        }
+        Py_DECREF(item);
+    }
+
+done:
+    Py_XDECREF(merged);
+    free_coverage_copies(copies);
+    return res;
+}
+
+/*[clinic input]
+monitoring.dump_coverage
+
+    path: object
+    /
+
+Write the result of get_coverage() to path, in marshal format.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_dump_coverage(PyObject *module, PyObject *path)
+/*[clinic end generated code: output=d6115626719209a2 input=0221fbaf38c769d5]*/
+{
+    PyObject *coverage = monitoring_get_coverage_impl(module);
+    if (coverage == NULL) {
+        return NULL;
+    }
+    PyObject *data = PyMarshal_WriteObjectToString(coverage, Py_MARSHAL_VERSION);
+    Py_DECREF(coverage);
+    if (data == NULL) {
+        return NULL;
+    }
+    FILE *fp = _Py_fopen_obj(path, "wb");
+    if (fp == NULL) {
+        Py_DECREF(data);
+        return NULL;
+    }
+    size_t size = (size_t)PyBytes_GET_SIZE(data);
+    int failed = fwrite(PyBytes_AS_STRING(data), 1, size, fp) != size;
+    Py_DECREF(data);
+    failed |= fclose(fp) != 0;
+    if (failed) {
+        PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, path);
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
 static PyMethodDef methods[] = {
     MONITORING_USE_TOOL_ID_METHODDEF
     MONITORING_FREE_TOOL_ID_METHODDEF
@@ -2117,6 +2561,10 @@ static PyMethodDef methods[] = {
     MONITORING_SET_LOCAL_EVENTS_METHODDEF
     MONITORING_RESTART_EVENTS_METHODDEF
     MONITORING__ALL_EVENTS_METHODDEF
+    MONITORING_START_COVERAGE_METHODDEF
+    MONITORING_STOP_COVERAGE_METHODDEF
+    MONITORING_GET_COVERAGE_METHODDEF
+    MONITORING_DUMP_COVERAGE_METHODDEF
     {NULL, NULL}  // sentinel
 };
 
@@ -327,6 +327,8 @@ _PyOpcode_num_popped(int opcode, int oparg, bool jump) {
             return oparg + 2;
         case CALL_PY_EXACT_ARGS:
             return oparg + 2;
+        case CALL_PY_TRIVIAL:
+            return oparg + 2;
         case CALL_PY_WITH_DEFAULTS:
             return oparg + 2;
         case CALL_NO_KW_TYPE_1:
@@ -725,6 +727,8 @@ _PyOpcode_num_pushed(int opcode, int oparg, bool jump) {
             return 1;
         case CALL_PY_EXACT_ARGS:
             return 1;
+        case CALL_PY_TRIVIAL:
+            return 1;
         case CALL_PY_WITH_DEFAULTS:
             return 1;
         case CALL_NO_KW_TYPE_1:
@@ -968,6 +972,7 @@ const struct opcode_metadata _PyOpcode_opcode_metadata[256] = {
     [CALL] = { true, INSTR_FMT_IBC00 },
     [CALL_BOUND_METHOD_EXACT_ARGS] = { true, INSTR_FMT_IBC00 },
     [CALL_PY_EXACT_ARGS] = { true, INSTR_FMT_IBC00 },
+    [CALL_PY_TRIVIAL] = { true, INSTR_FMT_IBC00 },
     [CALL_PY_WITH_DEFAULTS] = { true, INSTR_FMT_IBC00 },
     [CALL_NO_KW_TYPE_1] = { true, INSTR_FMT_IBC00 },
     [CALL_NO_KW_STR_1] = { true, INSTR_FMT_IBC00 },
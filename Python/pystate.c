@@ -701,6 +701,11 @@ init_interpreter(PyInterpreterState *interp,
 
         }
     }
+    interp->monitoring_coverage_tool = -1;
+    interp->monitoring_coverage_data = NULL;
+    interp->monitoring_coverage_restart_version = 0;
+    interp->monitoring_coverage_dump_path = NULL;
+    interp->monitoring_coverage_dump_registered = 0;
     interp->sys_profile_initialized = false;
     interp->sys_trace_initialized = false;
     if (interp != &runtime->_main_interpreter) {
@@ -867,6 +872,10 @@ interpreter_clear(PyInterpreterState *interp, PyThreadState *tstate)
     for (int t = 0; t < PY_MONITORING_TOOL_IDS; t++) {
         Py_CLEAR(interp->monitoring_tool_names[t]);
     }
+    interp->monitoring_coverage_tool = -1;
+    _PyMonitoring_ClearCoverage(interp);
+    Py_CLEAR(interp->monitoring_coverage_dump_path);
+    interp->monitoring_coverage_dump_registered = 0;
 
     PyConfig_Clear(&interp->config);
     Py_CLEAR(interp->codec_search_path);
@@ -1105,6 +1114,29 @@ _PyInterpreterState_IsRunningMain(PyInterpreterState *interp)
     return (interp->threads_main != NULL);
 }
 
+/* The count is updated from the receiving interpreters, which don't hold
+   the GIL of the exporting one, so it is protected by the HEAD lock. */
+
+void
+_PyInterpreterState_AddSharedBuffers(PyInterpreterState *interp, int delta)
+{
+    _PyRuntimeState *runtime = interp->runtime;
+    HEAD_LOCK(runtime);
+    interp->shared_buffers += delta;
+    assert(interp->shared_buffers >= 0);
+    HEAD_UNLOCK(runtime);
+}
+
+int
+_PyInterpreterState_HasSharedBuffers(PyInterpreterState *interp)
+{
+    _PyRuntimeState *runtime = interp->runtime;
+    HEAD_LOCK(runtime);
+    int res = (interp->shared_buffers != 0);
+    HEAD_UNLOCK(runtime);
+    return res;
+}
+
 
 //----------
 // accessors
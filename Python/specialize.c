@@ -176,6 +176,8 @@ print_object_stats(FILE *out, ObjectStats *stats)
 {
     fprintf(out, "Object allocations from freelist: %" PRIu64 "\n", stats->from_freelist);
     fprintf(out, "Object frees to freelist: %" PRIu64 "\n", stats->to_freelist);
+    fprintf(out, "Object generator freelist hits: %" PRIu64 "\n", stats->gen_freelist_hits);
+    fprintf(out, "Object generator freelist misses: %" PRIu64 "\n", stats->gen_freelist_misses);
     fprintf(out, "Object allocations: %" PRIu64 "\n", stats->allocations);
     fprintf(out, "Object allocations to 512 bytes: %" PRIu64 "\n", stats->allocations512);
     fprintf(out, "Object allocations to 4 kbytes: %" PRIu64 "\n", stats->allocations4k);
@@ -1666,6 +1668,32 @@ specialize_method_descriptor(PyMethodDescrObject *descr, _Py_CODEUNIT *instr,
     return -1;
 }
 
+/* Returns true if the body of code is just "return <constant>" or
+ * "return <argument>". Calls to such functions cannot raise, cannot observe
+ * their own frame and cannot recurse, so CALL_PY_TRIVIAL can compute the
+ * result without pushing a frame at all.
+ * The check is repeated at runtime against the (possibly instrumented)
+ * bytecode, so this only has to hold at specialization time. */
+static bool
+function_is_trivial(PyCodeObject *code)
+{
+    if (Py_SIZE(code) < 2) {
+        return false;
+    }
+    _Py_CODEUNIT *body = _PyCode_CODE(code);
+    if (body[0].op.code != RESUME) {
+        /* Generators, coroutines and functions with cells */
+        return false;
+    }
+    if (body[1].op.code == RETURN_CONST) {
+        return true;
+    }
+    return Py_SIZE(code) >= 3 &&
+        body[1].op.code == LOAD_FAST &&
+        body[1].op.arg < code->co_argcount &&
+        body[2].op.code == RETURN_VALUE;
+}
+
 static int
 specialize_py_call(PyFunctionObject *func, _Py_CODEUNIT *instr, int nargs,
                    PyObject *kwnames, bool bound_method)
@@ -1704,7 +1732,15 @@ specialize_py_call(PyFunctionObject *func, _Py_CODEUNIT *instr, int nargs,
     }
     write_u32(cache->func_version, version);
     if (argcount == nargs) {
-        instr->op.code = bound_method ? CALL_BOUND_METHOD_EXACT_ARGS : CALL_PY_EXACT_ARGS;
+        if (bound_method) {
+            instr->op.code = CALL_BOUND_METHOD_EXACT_ARGS;
+        }
+        else if (function_is_trivial(code)) {
+            instr->op.code = CALL_PY_TRIVIAL;
+        }
+        else {
+            instr->op.code = CALL_PY_EXACT_ARGS;
+        }
     }
     else if (bound_method) {
         SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_BOUND_METHOD);
@@ -0,0 +1,244 @@
+"""Micro-benchmarks for one iteration of the asyncio event loop.
+
+Each benchmark reports the time per loop iteration, for:
+
+  ready     callbacks scheduled with call_soon()
+  timers    callbacks scheduled with call_later(), with many pending timers
+  io        readiness callbacks of socket pairs registered with add_reader()
+  sock      ping-pong between tasks with sock_recv() and sock_sendall()
+  stream    echo over TCP connections with streams
+  file      reads of a file: pread() with --loop uring, run_in_executor()
+            and os.pread() otherwise
+
+Run with --python to use the pure Python versions of the loop helpers
+that have C accelerators in _asyncio, and compare the two.  Run with
+--loop uring to compare the io_uring event loop with the selector event
+loop.  Use a release build: a --with-pydebug build slows C code down much
+more than Python code.
+"""
+
+import argparse
+import asyncio
+import os
+import socket
+import sys
+import tempfile
+import time
+from asyncio import base_events, selector_events
+
+
+def bench_ready(loop, iterations, width):
+    count = 0
+
+    def callback():
+        nonlocal count
+        count += 1
+        if count < iterations * width:
+            loop.call_soon(callback)
+        elif count == iterations * width:
+            loop.stop()
+
+    for _ in range(width):
+        loop.call_soon(callback)
+    loop.run_forever()
+
+
+def bench_timers(loop, iterations, width):
+    # Timers far in the future keep the heap deep
+    pending = [loop.call_later(3600 + i, lambda: None) for i in range(1000)]
+    count = 0
+
+    def callback():
+        nonlocal count
+        count += 1
+        if count < iterations * width:
+            loop.call_later(0, callback)
+        elif count == iterations * width:
+            loop.stop()
+
+    for _ in range(width):
+        loop.call_later(0, callback)
+    loop.run_forever()
+    for handle in pending:
+        handle.cancel()
+
+
+def bench_io(loop, iterations, width):
+    pairs = [socket.socketpair() for _ in range(width)]
+    count = 0
+
+    def on_readable(rsock, wsock):
+        nonlocal count
+        rsock.recv(1)
+        count += 1
+        if count < iterations * width:
+            wsock.send(b'x')
+        elif count == iterations * width:
+            loop.stop()
+
+    try:
+        for rsock, wsock in pairs:
+            rsock.setblocking(False)
+            loop.add_reader(rsock, on_readable, rsock, wsock)
+            wsock.send(b'x')
+        loop.run_forever()
+    finally:
+        for rsock, wsock in pairs:
+            loop.remove_reader(rsock)
+            rsock.close()
+            wsock.close()
+
+
+def bench_sock(loop, iterations, width):
+    pairs = [socket.socketpair() for _ in range(width)]
+
+    async def ping(sock):
+        for _ in range(iterations):
+            await loop.sock_sendall(sock, b'x')
+            await loop.sock_recv(sock, 1)
+
+    async def pong(sock):
+        for _ in range(iterations):
+            await loop.sock_recv(sock, 1)
+            await loop.sock_sendall(sock, b'x')
+
+    async def main():
+        await asyncio.gather(*[pong(b) for a, b in pairs],
+                             *[ping(a) for a, b in pairs])
+
+    try:
+        for a, b in pairs:
+            a.setblocking(False)
+            b.setblocking(False)
+        loop.run_until_complete(main())
+    finally:
+        for a, b in pairs:
+            a.close()
+            b.close()
+
+
+def bench_stream(loop, iterations, width):
+    async def echo(reader, writer):
+        while data := await reader.read(100):
+            writer.write(data)
+        writer.close()
+
+    async def client(port):
+        reader, writer = await asyncio.open_connection('127.0.0.1', port)
+        for _ in range(iterations):
+            writer.write(b'x')
+            await reader.readexactly(1)
+        writer.close()
+        await writer.wait_closed()
+
+    async def main():
+        server = await asyncio.start_server(echo, '127.0.0.1', 0)
+        port = server.sockets[0].getsockname()[1]
+        async with server:
+            await asyncio.gather(*[client(port) for _ in range(width)])
+
+    loop.run_until_complete(main())
+
+
+def bench_file(loop, iterations, width):
+    size = 4096
+
+    async def reader(fd, pread):
+        for i in range(iterations):
+            await pread(fd, size, (i % 256) * size)
+
+    async def main(fd):
+        if hasattr(loop, 'pread'):
+            pread = loop.pread
+        else:
+            def pread(fd, size, offset):
+                return loop.run_in_executor(None, os.pread, fd, size, offset)
+        await asyncio.gather(*[reader(fd, pread) for _ in range(width)])
+
+    with tempfile.TemporaryFile() as f:
+        f.write(os.urandom(256 * size))
+        f.flush()
+        loop.run_until_complete(main(f.fileno()))
+        loop.run_until_complete(loop.shutdown_default_executor())
+
+
+BENCHMARKS = {
+    'ready': bench_ready,
+    'timers': bench_timers,
+    'io': bench_io,
+    'sock': bench_sock,
+    'stream': bench_stream,
+    'file': bench_file,
+}
+
+
+def use_python_helpers():
+    base_events._run_ready = base_events._py_run_ready
+    base_events._pop_due_timers = base_events._py_pop_due_timers
+    selector_events._process_selector_events = (
+        selector_events._py_process_selector_events)
+
+
+def run(name, iterations, width, repeat, loop_factory):
+    best = float('inf')
+    for _ in range(repeat):
+        loop = loop_factory()
+        try:
+            t0 = time.perf_counter()
+            BENCHMARKS[name](loop, iterations, width)
+            best = min(best, time.perf_counter() - t0)
+        finally:
+            loop.close()
+    return best / iterations
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('benchmarks', nargs='*', default=list(BENCHMARKS),
+                        metavar='benchmark',
+                        help='benchmarks to run (default: all of %s)'
+                             % ', '.join(BENCHMARKS))
+    parser.add_argument('-n', '--iterations', type=int, default=2000,
+                        help='loop iterations per run (default: %(default)s)')
+    parser.add_argument('-w', '--width', type=int, default=10,
+                        help='callbacks, tasks or connections per iteration '
+                             '(default: %(default)s)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='runs, the best is reported '
+                             '(default: %(default)s)')
+    parser.add_argument('--python', action='store_true',
+                        help='use the pure Python loop helpers')
+    parser.add_argument('--loop', choices=('selector', 'uring'),
+                        default='selector',
+                        help='event loop to use (default: %(default)s)')
+    args = parser.parse_args()
+    for name in args.benchmarks:
+        if name not in BENCHMARKS:
+            parser.error('unknown benchmark: %r' % name)
+
+    if args.loop == 'uring':
+        from asyncio import uring_events
+        loop_factory = uring_events.IoUringEventLoop
+        if 'io' in args.benchmarks:
+            if args.benchmarks is parser.get_default('benchmarks'):
+                args.benchmarks.remove('io')
+            else:
+                parser.error('the io benchmark needs add_reader(), '
+                             'which the uring loop does not have')
+    else:
+        loop_factory = asyncio.SelectorEventLoop
+
+    if hasattr(sys, 'gettotalrefcount'):
+        print('warning: this is a debug build, timings are not '
+              'representative', file=sys.stderr)
+    if args.python:
+        use_python_helpers()
+    for name in args.benchmarks:
+        t = run(name, args.iterations, args.width, args.repeat,
+                loop_factory)
+        print('%-8s %8.2f us per iteration (width %d)'
+              % (name, t * 1e6, args.width))
+
+
+if __name__ == '__main__':
+    main()